@@ -0,0 +1,72 @@
+#pragma once
+#include <bits/stdc++.h>
+#include <immintrin.h>
+using namespace std;
+
+// A runtime sized matrix of bits, stored row by row in 64-bit words, with
+//   each row padded to a multiple of 4 words so that every row starts at a
+//   256-bit boundary relative to the start of the matrix
+// The row operations are vectorized with AVX2 if the processor supports it
+// Indices are 0-indexed
+// Constructor Arguments:
+//   N: the number of rows
+//   M: the number of columns
+// Fields:
+//   N: the number of rows
+//   M: the number of columns
+//   W: the number of words in each row
+//   A: the words of the matrix, where bit j of row i is bit j % 64 of
+//     A[i * W + j / 64]
+//   AVX2: whether the AVX2 row operations are used
+// Functions:
+//   operator [i]: returns a pointer to the first word of row i
+//   get(i, j): returns bit j of row i
+//   set(i, j, b): sets bit j of row i to b
+//   orRow(i, k): sets row i to the bitwise or of rows i and k
+//   orRow(dst, src): sets the W words starting at dst to the bitwise or of
+//     those words and the W words starting at src
+//   count(i): returns the number of bits set in row i
+// In practice, has a very small constant
+// Time Complexity:
+//   constructor: O(N M / 64)
+//   operator [], get, set: O(1)
+//   orRow, count: O(M / 64)
+// Memory Complexity: O(N M / 64)
+// Tested:
+//   Fuzz and Stress Tested
+struct BitMatrix {
+  using u64 = uint64_t; int N, M, W; vector<u64> A; bool AVX2;
+  BitMatrix(int N = 0, int M = 0)
+      : N(N), M(M), W((M + 255) / 256 * 4), A(size_t(N) * W, 0),
+        AVX2(__builtin_cpu_supports("avx2")) {}
+  u64 *operator [] (int i) { return A.data() + size_t(i) * W; }
+  const u64 *operator [] (int i) const { return A.data() + size_t(i) * W; }
+  bool get(int i, int j) const { return ((*this)[i][j >> 6] >> (j & 63)) & 1; }
+  void set(int i, int j, bool b = true) {
+    u64 &x = (*this)[i][j >> 6], m = u64(1) << (j & 63);
+    if (b) x |= m;
+    else x &= ~m;
+  }
+  __attribute__((target("avx2")))
+  static void orAVX2(u64 *dst, const u64 *src, int W) {
+    for (int i = 0; i < W; i += 4) {
+      __m256i *d = reinterpret_cast<__m256i *>(dst + i);
+      const __m256i *s = reinterpret_cast<const __m256i *>(src + i);
+      _mm256_storeu_si256(d, _mm256_or_si256(_mm256_loadu_si256(d),
+                                             _mm256_loadu_si256(s)));
+    }
+  }
+  static void orDefault(u64 *dst, const u64 *src, int W) {
+    for (int i = 0; i < W; i++) dst[i] |= src[i];
+  }
+  void orRow(u64 *dst, const u64 *src) const {
+    if (AVX2) orAVX2(dst, src, W);
+    else orDefault(dst, src, W);
+  }
+  void orRow(int i, int k) { orRow((*this)[i], (*this)[k]); }
+  int count(int i) const {
+    int ret = 0; const u64 *a = (*this)[i];
+    for (int j = 0; j < W; j++) ret += __builtin_popcountll(a[j]);
+    return ret;
+  }
+};
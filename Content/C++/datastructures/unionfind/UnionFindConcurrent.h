@@ -0,0 +1,71 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Lock-free Union Find by index with path splitting, where find, join, and
+//   connected can be called concurrently from any number of threads
+// Each element points to a smaller element, or to itself if it is a root,
+//   so the root of each set is always its minimum element, and a join
+//   links the larger root to the smaller root with a compare and swap,
+//   retrying if either root was linked by another thread in the meantime
+// Path splitting replaces the parent of each element on the path with its
+//   grandparent with a compare and swap that is allowed to fail, so find
+//   never waits on other threads
+// Indices are 0-indexed
+// Constructor Arguments:
+//   N: the number of elements in the set
+// Fields:
+//   UF: a vector of integers representing the parent of each element in the
+//     tree, or the element itself if it is a root
+//   cnt: the current number of disjoint sets
+// Functions:
+//   find(v): finds the root of the set containing element v, which is the
+//     minimum element of that set
+//   join(v, w): merges the sets containing v and w, returns true if they
+//     were originally disjoint before the merge, false otherwise
+//   connected(v, w): returns true if v and w are in the same set,
+//     false otherwise
+//   getCnt(): returns the current number of disjoint sets
+// In practice, has a small constant, slightly larger than UnionFind when
+//   used by a single thread
+// Time Complexity:
+//   constructor: O(N)
+//   find, join, connected: O(log N) amortized, not counting retries caused
+//     by other threads
+//   getCnt: O(1)
+// Memory Complexity: O(N)
+// Tested:
+//   Fuzz and Stress Tested
+struct UnionFindConcurrent {
+  vector<int> UF; int cnt;
+  UnionFindConcurrent(int N) : UF(N), cnt(N) {
+    iota(UF.begin(), UF.end(), 0);
+  }
+  int par(int v) const { return __atomic_load_n(&UF[v], __ATOMIC_ACQUIRE); }
+  bool cas(int v, int old, int p) {
+    return __atomic_compare_exchange_n(&UF[v], &old, p, false,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+  }
+  int find(int v) {
+    for (int p = par(v); p != v; v = p, p = par(v)) {
+      int gp = par(p); if (p != gp) cas(v, p, gp);
+    }
+    return v;
+  }
+  bool join(int v, int w) {
+    while (true) {
+      if ((v = find(v)) == (w = find(w))) return false;
+      if (v > w) swap(v, w);
+      if (cas(w, w, v)) {
+        __atomic_sub_fetch(&cnt, 1, __ATOMIC_RELAXED); return true;
+      }
+    }
+  }
+  bool connected(int v, int w) {
+    while (true) {
+      if ((v = find(v)) == (w = find(w))) return true;
+      if (par(v) == v) return false;
+    }
+  }
+  int getCnt() const { return __atomic_load_n(&cnt, __ATOMIC_RELAXED); }
+};
@@ -1,8 +1,10 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../search/DepthFirstStack.h"
 using namespace std;
 
-// Computes the biconnected components of an undirected graph
+// Computes the biconnected components of an undirected graph, with an
+//   explicit stack for the depth first search
 // Vertices are 0-indexed
 // Constructor Arguments:
 //   G: a generic undirected graph structure
@@ -40,24 +42,30 @@ struct BCC {
       tie(x, y) = stk.back(); stk.pop_back(); assign(x, id); assign(y, id);
     } while (!stk.empty() && (x != v || y != w));
   }
-  template <class Graph> void dfs(const Graph &G, int v, int prev) {
-    low[v] = pre[v] = ind++; int children = 0; for (int w : G[v]) {
-      if (pre[w] == -1) {
-        children++; stk.emplace_back(v, w); dfs(G, w, v);
-        low[v] = min(low[v], low[w]);
-        if ((prev == -1 && children > 1) || (prev != -1 && low[w] >= pre[v])) {
-          articulation[v] = true; makeComponent(v, w);
+  template <class Graph> void dfs(DFSStack<Graph> &S, int s) {
+    low[s] = pre[s] = ind++; S.push(s, 0); while (!S.empty()) {
+      int v = S.top(), prev = S.parent(), w; if (S.next(w)) {
+        if (pre[w] == -1) {
+          S.val()++; stk.emplace_back(v, w); low[w] = pre[w] = ind++;
+          S.push(w, 0);
+        } else if (w != prev && pre[w] < low[v]) {
+          low[v] = pre[w]; stk.emplace_back(v, w);
         }
-      } else if (w != prev && pre[w] < low[v]) {
-        low[v] = pre[w]; stk.emplace_back(v, w);
+        continue;
+      }
+      S.pop(); if (prev == -1) continue;
+      w = v; v = prev; prev = S.parent(); low[v] = min(low[v], low[w]);
+      if ((prev == -1 && S.val() > 1) || (prev != -1 && low[w] >= pre[v])) {
+        articulation[v] = true; makeComponent(v, w);
       }
     }
   }
   template <class Graph> BCC(const Graph &G)
       : ind(0), low(G.size()), pre(G.size(), -1),
         ids(G.size()), articulation(G.size(), false) {
+    DFSStack<Graph> S(G);
     for (int v = 0; v < int(G.size()); v++) if (pre[v] == -1) {
-      dfs(G, v, -1); if (!stk.empty()) makeComponent();
+      dfs(S, v); if (!stk.empty()) makeComponent();
     }
   }
   template <class Graph>
@@ -1,9 +1,10 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../search/DepthFirstStack.h"
 using namespace std;
 
 // Decomposes an undirected graph into 2-edge connected components and
-//   identifies bridges
+//   identifies bridges, with an explicit stack for the depth first search
 // Vertices are 0-indexed
 // Constructor Arguments:
 //   G: a generic undirected graph structure
@@ -33,21 +34,30 @@ struct Bridges {
       components.back().push_back(w);
     } while (w != v);
   }
-  template <class Graph> void dfs(const Graph &G, int v, int prev) {
-    id[stk[top++] = v] = -1; low[v] = pre[v] = ind++; bool parEdge = false;
-    for (int w : G[v]) {
-      if (w == prev && !parEdge) { parEdge = true; continue; }
-      if (id[w] == -2) {
-        dfs(G, w, v); low[v] = min(low[v], low[w]);
-        if (low[w] == pre[w]) { bridges.emplace_back(v, w); makeComponent(w); }
-      } else if (id[w] == -1) low[v] = min(low[v], pre[w]);
+  template <class Graph> void enter(DFSStack<Graph> &S, int v) {
+    id[stk[top++] = v] = -1; low[v] = pre[v] = ind++; S.push(v, false);
+  }
+  template <class Graph> void dfs(DFSStack<Graph> &S, int s) {
+    enter(S, s); while (!S.empty()) {
+      int v = S.top(), prev = S.parent(), w; if (S.next(w)) {
+        if (w == prev && !S.val()) { S.val() = true; continue; }
+        if (id[w] == -2) enter(S, w);
+        else if (id[w] == -1) low[v] = min(low[v], pre[w]);
+        continue;
+      }
+      S.pop(); if (prev == -1) continue;
+      low[prev] = min(low[prev], low[v]);
+      if (low[v] == pre[v]) {
+        bridges.emplace_back(prev, v); makeComponent(v);
+      }
     }
   }
   template <class Graph> Bridges(const Graph &G)
       : ind(0), top(0), id(G.size(), -2), low(G.size()), pre(G.size()),
         stk(G.size()) {
+    DFSStack<Graph> S(G);
     for (int v = 0; v < int(G.size()); v++) if (id[v] == -2) {
-      dfs(G, v, -1); if (top > 0) makeComponent(v);
+      dfs(S, v); if (top > 0) makeComponent(v);
     }
   }
 };
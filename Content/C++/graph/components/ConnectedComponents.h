@@ -1,6 +1,8 @@
 #pragma once
 #include <bits/stdc++.h>
 #include "../../datastructures/unionfind/UnionFind.h"
+#include "../../utils/ThreadPool.h"
+#include "../representations/StaticGraph.h"
 using namespace std;
 
 // Computes the connected components of a graph using Union Find
@@ -35,3 +37,84 @@ struct CC {
       components[id[v] = id[uf.find(v)]].push_back(v);
   }
 };
+
+// Computes the connected components of an undirected static graph in
+//   parallel using Afforest, where each vertex points to a smaller vertex
+//   in its component or to itself, and edges are processed concurrently by
+//   linking the larger of the two roots to the smaller one with a compare
+//   and swap
+// The first NEIGHBOUR_ROUNDS edges of each vertex are linked in rounds,
+//   followed by a sample of SAMPLES vertices to find the most frequent
+//   component, and the remaining edges are only linked for vertices outside
+//   of that component, which skips most of the edges in graphs with a giant
+//   component
+// The root of each component is its smallest vertex, and the components are
+//   sorted by their smallest vertex, so the result does not depend on the
+//   number of threads
+// Vertices are 0-indexed
+// Template Arguments:
+//   Policy: the execution policy for each round, either SerialPolicy or
+//     ParallelPolicy
+// Constructor Arguments:
+//   G: an undirected StaticGraph, with each edge in both directions
+// Fields:
+//   id: a vector of the index of the component each vertex is part of
+//   components: a vector of vectors containing the vertices in each
+//     component, in increasing order
+// In practice, has a small constant, faster than CC on a single thread for
+//   graphs with a giant component, and scales with the number of threads
+// Time Complexity:
+//   constructor: O((V + E) log V) in the worst case, O(V + E) in practice,
+//     with each round split across P threads
+// Memory Complexity: O(V)
+// Tested:
+//   Fuzz and Stress Tested
+template <class Policy = SerialPolicy> struct AfforestCC {
+  static constexpr int NEIGHBOUR_ROUNDS = 2, SAMPLES = 1024;
+  int V; vector<int> id; vector<vector<int>> components;
+  AfforestCC(const StaticGraph &G) : V(G.size()), id(V) {
+    vector<int> P(V); iota(P.begin(), P.end(), 0);
+    auto get = [&] (int v) {
+      return __atomic_load_n(&P[v], __ATOMIC_RELAXED);
+    };
+    auto link = [&] (int v, int w) {
+      int p = get(v), q = get(w); while (p != q) {
+        int hi = max(p, q), lo = min(p, q), r = get(hi); if (r == lo) break;
+        if (r == hi && __atomic_compare_exchange_n(
+            &P[hi], &r, lo, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+          break;
+        p = get(get(hi)); q = get(lo);
+      }
+    };
+    auto compress = [&] {
+      Policy::forRange(0, V, [&] (int lo, int hi) {
+        for (int v = lo; v < hi; v++) for (int p; (p = get(get(v))) != get(v);)
+          __atomic_store_n(&P[v], p, __ATOMIC_RELAXED);
+      }, 1 << 12);
+    };
+    for (int r = 0; r < NEIGHBOUR_ROUNDS; r++) {
+      Policy::forRange(0, V, [&] (int lo, int hi) {
+        for (int v = lo; v < hi; v++)
+          if (G.ST[v] + r < G.ST[v + 1]) link(v, G.TO[G.ST[v] + r]);
+      }, 1 << 12);
+      compress();
+    }
+    int c = -1; if (V > 0) {
+      mt19937_64 rng(0); unordered_map<int, int> freq; int best = 0;
+      for (int i = 0; i < SAMPLES; i++) {
+        int p = P[rng() % V], f = ++freq[p];
+        if (f > best || (f == best && p < c)) { best = f; c = p; }
+      }
+    }
+    Policy::forRange(0, V, [&] (int lo, int hi) {
+      for (int v = lo; v < hi; v++) if (get(v) != c)
+        for (int e = G.ST[v] + NEIGHBOUR_ROUNDS; e < G.ST[v + 1]; e++)
+          link(v, G.TO[e]);
+    }, 1 << 10);
+    compress(); for (int v = 0; v < V; v++) {
+      if (P[v] == v) { id[v] = components.size(); components.emplace_back(); }
+      else id[v] = id[P[v]];
+      components[id[v]].push_back(v);
+    }
+  }
+};
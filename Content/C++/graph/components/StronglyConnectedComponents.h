@@ -1,9 +1,12 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../../utils/ThreadPool.h"
+#include "../representations/StaticGraph.h"
+#include "../search/DepthFirstStack.h"
 using namespace std;
 
 // Computes the strongly connected components of a directed graph using
-//   Tarjan's algorithm
+//   Tarjan's algorithm, with an explicit stack for the depth first search
 // Vertices are 0-indexed
 // Constructor Arguments:
 //   G: a generic directed graph structure
@@ -31,20 +34,30 @@ using namespace std;
 //   https://ecna18.kattis.com/problems/watchyourstep
 struct SCC {
   int ind, top; vector<int> id, low, stk; vector<vector<int>> components;
-  template <class Digraph> void dfs(const Digraph &G, int v) {
-    id[stk[top++] = v] = -1; int mn = low[v] = ind++; for (int w : G[v]) {
-      if (id[w] == -2) dfs(G, w);
-      mn = min(mn, low[w]);
+  template <class Digraph> void enter(DFSStack<Digraph> &S, int v) {
+    id[stk[top++] = v] = -1; low[v] = ind++; S.push(v, low[v]);
+  }
+  template <class Digraph> void dfs(DFSStack<Digraph> &S, int s) {
+    enter(S, s); while (!S.empty()) {
+      int v = S.top(), w; if (S.next(w)) {
+        if (id[w] == -2) enter(S, w);
+        else S.val() = min(S.val(), low[w]);
+        continue;
+      }
+      int mn = S.val(); S.pop(); if (mn < low[v]) low[v] = mn;
+      else {
+        components.emplace_back(); do {
+          id[w = stk[--top]] = components.size() - 1; low[w] = INT_MAX;
+          components.back().push_back(w);
+        } while (w != v);
+      }
+      if (!S.empty()) S.val() = min(S.val(), low[v]);
     }
-    if (mn < low[v]) { low[v] = mn; return; }
-    int w; components.emplace_back(); do {
-      id[w = stk[--top]] = components.size() - 1; low[w] = INT_MAX;
-      components.back().push_back(w);
-    } while (w != v);
   }
   template <class Digraph> SCC(const Digraph &G)
       : ind(0), top(0), id(G.size(), -2), low(G.size()), stk(G.size()) {
-    for (int v = 0; v < int(G.size()); v++) if (id[v] == -2) dfs(G, v);
+    DFSStack<Digraph> S(G);
+    for (int v = 0; v < int(G.size()); v++) if (id[v] == -2) dfs(S, v);
   }
   template <class Digraph>
   SCC(const Digraph &G, vector<pair<int, int>> &condensationEdges) : SCC(G) {
@@ -54,3 +67,165 @@ struct SCC {
         condensationEdges.emplace_back(last[id[w]] = id[v], id[w]);
   }
 };
+
+// Computes the strongly connected components of a static directed graph in
+//   parallel, by first trimming every vertex that has no remaining in edges
+//   or no remaining out edges as its own component, then finding the
+//   component of the vertex with the largest product of its remaining in
+//   and out degrees as the intersection of its forward and backward
+//   reachable sets, and then repeatedly coloring each remaining vertex with
+//   the largest remaining vertex that can reach it, so that each vertex
+//   whose color is itself is the root of a component containing the
+//   vertices of the same color that can reach it
+// The colors are propagated in parallel until they stop changing, or with
+//   a breadth first search from each remaining vertex in decreasing order if
+//   there is only one thread, which gives the same colors
+// Every step is a parallel breadth first traversal or label propagation
+//   where each vertex is claimed with a compare and swap, and the components
+//   are sorted by their smallest vertex, so the result does not depend on
+//   the number of threads
+// Vertices are 0-indexed
+// Template Arguments:
+//   Policy: the execution policy for each step, either SerialPolicy or
+//     ParallelPolicy
+// Constructor Arguments:
+//   G: a StaticGraph
+//   GT: a StaticGraph with every edge of G reversed
+// Fields:
+//   id: a vector of the index of the scc each vertex is part of
+//   components: a vector of vectors containing the vertices in each scc, in
+//     increasing order, sorted by the smallest vertex (which is not a
+//     topological order, unlike SCC)
+// In practice, has a moderate constant, slower than SCC on a single thread,
+//   and scales with the number of threads on graphs with a giant component
+//   and many trivial components
+// Time Complexity:
+//   constructor: O(V + E) for the trimming and the largest component, plus
+//     O(K (V + E) D) for the K coloring rounds with at most D propagation
+//     steps each on the remaining vertices, with each step split across P
+//     threads
+// Memory Complexity: O(V + E)
+// Tested:
+//   Fuzz and Stress Tested
+template <class Policy = SerialPolicy> struct ParallelSCC {
+  vector<int> id; vector<vector<int>> components;
+  static int load(const int &x) {
+    return __atomic_load_n(&x, __ATOMIC_RELAXED);
+  }
+  static bool claim(int &x, int v) {
+    int e = -1; return __atomic_compare_exchange_n(
+        &x, &e, v, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+  }
+  template <class Visit> static void advance(vector<int> &F, Visit f) {
+    vector<int> N; mutex mtx;
+    Policy::forRange(0, int(F.size()), [&] (int lo, int hi) {
+      vector<int> loc; for (int i = lo; i < hi; i++) f(F[i], loc);
+      lock_guard<mutex> lock(mtx); N.insert(N.end(), loc.begin(), loc.end());
+    }, 1 << 10);
+    F.swap(N);
+  }
+  static StaticGraph transpose(const StaticGraph &G) {
+    StaticGraph GT(G.size()); GT.reserveDiEdges(G.TO.size());
+    for (int v = 0; v < G.size(); v++)
+      for (int e = G.ST[v]; e < G.ST[v + 1]; e++) GT.addDiEdge(G.TO[e], v);
+    GT.build(); return GT;
+  }
+  ParallelSCC(const StaticGraph &G, const StaticGraph &GT) : id(G.size()) {
+    int V = G.size(); vector<int> rep(V, -1), in(V, 0), out(V, 0), F, R;
+    Policy::forRange(0, V, [&] (int lo, int hi) {
+      for (int v = lo; v < hi; v++) {
+        for (int e = G.ST[v]; e < G.ST[v + 1]; e++) out[v] += G.TO[e] != v;
+        for (int e = GT.ST[v]; e < GT.ST[v + 1]; e++) in[v] += GT.TO[e] != v;
+      }
+    }, 1 << 12);
+    for (int v = 0; v < V; v++) if (in[v] == 0 || out[v] == 0) {
+      rep[v] = v; F.push_back(v);
+    }
+    while (!F.empty()) advance(F, [&] (int v, vector<int> &nxt) {
+      for (int e = G.ST[v]; e < G.ST[v + 1]; e++) {
+        int w = G.TO[e]; if (w != v && __atomic_sub_fetch(
+            &in[w], 1, __ATOMIC_RELAXED) == 0 && claim(rep[w], w))
+          nxt.push_back(w);
+      }
+      for (int e = GT.ST[v]; e < GT.ST[v + 1]; e++) {
+        int w = GT.TO[e]; if (w != v && __atomic_sub_fetch(
+            &out[w], 1, __ATOMIC_RELAXED) == 0 && claim(rep[w], w))
+          nxt.push_back(w);
+      }
+    });
+    long long best = -1; int s = -1; for (int v = 0; v < V; v++)
+      if (rep[v] == -1 && (long long)in[v] * out[v] > best) {
+        best = (long long)in[v] * out[v]; s = v;
+      }
+    vector<int> fw(V, -1), color(V, -1); if (s != -1) {
+      fw[s] = s; F.assign(1, s); while (!F.empty()) {
+        advance(F, [&] (int v, vector<int> &nxt) {
+          for (int e = G.ST[v]; e < G.ST[v + 1]; e++) {
+            int w = G.TO[e];
+            if (load(rep[w]) == -1 && claim(fw[w], s)) nxt.push_back(w);
+          }
+        });
+      }
+      rep[s] = s; F.assign(1, s); while (!F.empty()) {
+        advance(F, [&] (int v, vector<int> &nxt) {
+          for (int e = GT.ST[v]; e < GT.ST[v + 1]; e++) {
+            int w = GT.TO[e];
+            if (load(fw[w]) == s && claim(rep[w], s)) nxt.push_back(w);
+          }
+        });
+      }
+    }
+    auto remaining = [&] {
+      R.clear(); mutex mtx; Policy::forRange(0, V, [&] (int lo, int hi) {
+        vector<int> loc; for (int v = lo; v < hi; v++)
+          if (rep[v] == -1) { color[v] = v; loc.push_back(v); }
+        lock_guard<mutex> lock(mtx); R.insert(R.end(), loc.begin(), loc.end());
+      }, 1 << 12);
+      return !R.empty();
+    };
+    vector<int> queued(V, -1); for (int step = 0; remaining();) {
+      if (Policy::threads() == 1) {
+        for (int v : R) color[v] = -1;
+        for (int i = int(R.size()) - 1; i >= 0; i--) if (color[R[i]] == -1) {
+          int c = R[i]; color[c] = c; F.assign(1, c);
+          for (int j = 0; j < int(F.size()); j++)
+            for (int e = G.ST[F[j]]; e < G.ST[F[j] + 1]; e++) {
+              int w = G.TO[e]; if (rep[w] == -1 && color[w] == -1) {
+                color[w] = c; F.push_back(w);
+              }
+            }
+        }
+      } else for (F = R; !F.empty(); step++) {
+        advance(F, [&] (int v, vector<int> &nxt) {
+          int c = load(color[v]); for (int e = G.ST[v]; e < G.ST[v + 1]; e++) {
+            int w = G.TO[e]; if (load(rep[w]) != -1) continue;
+            int old = load(color[w]);
+            while (old < c && !__atomic_compare_exchange_n(
+                &color[w], &old, c, false, __ATOMIC_RELAXED,
+                __ATOMIC_RELAXED));
+            if (old < c && __atomic_exchange_n(
+                &queued[w], step, __ATOMIC_RELAXED) != step)
+              nxt.push_back(w);
+          }
+        });
+      }
+      F.clear(); for (int v : R) if (color[v] == v) {
+        rep[v] = v; F.push_back(v);
+      }
+      while (!F.empty()) advance(F, [&] (int v, vector<int> &nxt) {
+        for (int e = GT.ST[v]; e < GT.ST[v + 1]; e++) {
+          int w = GT.TO[e];
+          if (color[w] == color[v] && claim(rep[w], color[v]))
+            nxt.push_back(w);
+        }
+      });
+    }
+    vector<int> ind(V, -1); for (int v = 0; v < V; v++) {
+      if (ind[rep[v]] == -1) {
+        ind[rep[v]] = components.size(); components.emplace_back();
+      }
+      components[id[v] = ind[rep[v]]].push_back(v);
+    }
+  }
+  ParallelSCC(const StaticGraph &G) : ParallelSCC(G, transpose(G)) {}
+};
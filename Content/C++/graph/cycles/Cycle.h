@@ -1,9 +1,10 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../search/DepthFirstStack.h"
 using namespace std;
 
 // Finds a cycle in an undirected graph (including self loops and
-//   parallel edges)
+//   parallel edges), with an explicit stack for the depth first search
 // Vertices are 0-indexed
 // Constructor Arguments:
 //   G: a generic undirected graph structure
@@ -23,14 +24,14 @@ using namespace std;
 //   https://cses.fi/problemset/task/1669
 struct Cycle {
   int V; vector<bool> vis; vector<int> to, cycle;
-  template <class Graph> void dfs(const Graph &G, int v, int prev) {
-    vis[v] = true; for (int w : G[v]) {
-      if (!vis[w]) dfs(G, w, to[w] = v);
+  template <class Graph> void dfs(DFSStack<Graph> &S, int s) {
+    vis[s] = true; S.push(s); while (!S.empty() && cycle.empty()) {
+      int v = S.top(), prev = S.parent(), w; if (!S.next(w)) S.pop();
+      else if (!vis[w]) { vis[w] = true; to[w] = v; S.push(w); }
       else if (w != prev) {
         for (int x = v; x != w; x = to[x]) cycle.push_back(x);
         cycle.push_back(w); cycle.push_back(v);
       }
-      if (!cycle.empty()) return;
     }
   }
   template <class Graph>
@@ -41,10 +42,11 @@ struct Cycle {
         if (vis[w]) {
           cycle.push_back(v); cycle.push_back(w); cycle.push_back(v); return;
         }
+        vis[w] = true;
       }
       for (int w : G[v]) vis[w] = false;
     }
-    fill(vis.begin(), vis.end(), false);
-    for (int v = 0; v < V && cycle.empty(); v++) if (!vis[v]) dfs(G, v, -1);
+    fill(vis.begin(), vis.end(), false); DFSStack<Graph> S(G);
+    for (int v = 0; v < V && cycle.empty(); v++) if (!vis[v]) dfs(S, v);
   }
 };
@@ -1,9 +1,10 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../search/DepthFirstStack.h"
 using namespace std;
 
 // Finds a directed cycle in a directed graph (including self loops and
-//   parallel edges)
+//   parallel edges), with an explicit stack for the depth first search
 // Vertices are 0-indexed
 // Constructor Arguments:
 //   G: a generic directed graph structure
@@ -24,20 +25,20 @@ using namespace std;
 //   https://judge.yosupo.jp/problem/cycle_detection
 struct DirectedCycle {
   int V; vector<bool> vis, onStk; vector<int> to, cycle;
-  template <class Digraph> void dfs(const Digraph &G, int v) {
-    vis[v] = onStk[v] = true; for (int w : G[v]) {
-      if (!vis[w]) { to[w] = v; dfs(G, w); }
+  template <class Digraph> void dfs(DFSStack<Digraph> &S, int s) {
+    vis[s] = onStk[s] = true; S.push(s); while (!S.empty() && cycle.empty()) {
+      int v = S.top(), w; if (!S.next(w)) { onStk[v] = false; S.pop(); }
+      else if (!vis[w]) { vis[w] = onStk[w] = true; to[w] = v; S.push(w); }
       else if (onStk[w]) {
         for (int x = v; x != w; x = to[x]) cycle.push_back(x);
         cycle.push_back(w); cycle.push_back(v);
         reverse(cycle.begin(), cycle.end());
       }
-      if (!cycle.empty()) return;
     }
-    onStk[v] = false;
   }
   template <class Digraph> DirectedCycle(const Digraph &G)
       : V(G.size()), vis(V, false), onStk(V, false), to(V) {
-    for (int v = 0; v < V && cycle.empty(); v++) if (!vis[v]) dfs(G, v);
+    DFSStack<Digraph> S(G);
+    for (int v = 0; v < V && cycle.empty(); v++) if (!vis[v]) dfs(S, v);
   }
 };
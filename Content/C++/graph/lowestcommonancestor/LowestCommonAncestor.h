@@ -1,11 +1,18 @@
 #pragma once
 #include <bits/stdc++.h>
 #include "../../datastructures/FischerHeunStructure.h"
+#include "../../utils/ThreadPool.h"
 using namespace std;
 
 // Supports queries for the lowest common ancestor of 2 vertices in a forest
 //   and the distance between 2 vertices by reduing the problem to a
 //   range minimum query using the Fischer Heun Structure
+// The pre order traversal is done with an explicit stack, so the depth of
+//   the forest is not limited by the size of the call stack
+// Batches of queries are mapped to ranges of pre order indices, which are
+//   sorted by their left endpoint with a counting sort, so that nearby
+//   queries access nearby parts of the structure, and then answered in
+//   parallel chunks
 // Vertices are 0-indexed
 // Template Arguments:
 //   T: the type of the weight of the edges in the forest
@@ -27,6 +34,9 @@ using namespace std;
 // Functions:
 //   lca(v, w): returns the lowest common ancestor of vertices v and w assuming
 //     v and w are connected
+//   lca<Policy>(queries): returns a vector of the lowest common ancestor of
+//     each pair of vertices in queries assuming each pair is connected,
+//     where the Policy is either SerialPolicy (by default) or ParallelPolicy
 //   connected(v, w): returns true if and only if v and w are connected
 //   dist(v, w): returns the distance between vertices v and w assuming
 //     v and w are connected
@@ -35,6 +45,7 @@ using namespace std;
 // Time Complexity:
 //   constructor: O(V)
 //   lca, connected, dist: O(1)
+//   lca(queries): O(V + Q) with the queries split across P threads
 // Memory Complexity: O(V)
 // Tested:
 //   https://judge.yosupo.jp/problem/lca
@@ -48,17 +59,25 @@ template <class T = int> struct LCA {
   T getWeight(int) { return 1; }
   int getTo(const pair<int, T> &e) { return e.first; }
   T getWeight(const pair<int, T> &e) { return e.second; }
-  template <class Forest>
-  void dfs(const Forest &G, int v, int prev, int r, T d) {
-    root[v] = r; dep[v] = d; pre[v] = vert.size(); for (auto &&e : G[v]) {
-      int w = getTo(e);
-      if (w != prev) { vert.push_back(v); dfs(G, w, v, r, d + getWeight(e)); }
+  template <class Forest> void dfs(const Forest &G, int r) {
+    using It = typename remove_const<decltype(G[0].begin())>::type;
+    struct Frame { int v, prev; It it, en; }; vector<Frame> stk;
+    auto push = [&] (int v, int prev) {
+      auto &&adj = G[v]; stk.push_back(Frame{v, prev, adj.begin(), adj.end()});
+    };
+    root[r] = r; dep[r] = T(); pre[r] = vert.size(); push(r, -1);
+    while (!stk.empty()) {
+      Frame &f = stk.back(); if (!(f.it != f.en)) { stk.pop_back(); continue; }
+      auto &&e = *f.it; ++f.it; int v = f.v, w = getTo(e);
+      if (w == f.prev) continue;
+      vert.push_back(v); root[w] = r; dep[w] = dep[v] + getWeight(e);
+      pre[w] = vert.size(); push(w, v);
     }
   }
   template <class Forest> RMQ init(const Forest &G, const vector<int> &roots) {
     vert.reserve(V); if (roots.empty()) {
-      for (int v = 0; v < V; v++) if (root[v] == -1) dfs(G, v, -1, v, T());
-    } else for (int v : roots) if (root[v] == -1) dfs(G, v, -1, v, T());
+      for (int v = 0; v < V; v++) if (root[v] == -1) dfs(G, v);
+    } else for (int v : roots) if (root[v] == -1) dfs(G, v);
     int i = 0; return RMQ(vert.size(), [&] { return pre[vert[i++]]; });
   }
   template <class Forest>
@@ -71,6 +90,22 @@ template <class T = int> struct LCA {
     if (pre[v] > pre[w]) swap(v, w);
     return vert[FHS.query(pre[v], pre[w] - 1)];
   }
+  template <class Policy = SerialPolicy>
+  vector<int> lca(const vector<pair<int, int>> &queries) {
+    int Q = queries.size(), K = 0; vector<int> ret(Q), cnt(V + 1, 0);
+    vector<array<int, 3>> P(Q), S(Q); for (int i = 0; i < Q; i++) {
+      int l = pre[queries[i].first], r = pre[queries[i].second];
+      if (l == r) ret[i] = queries[i].first;
+      else { if (l > r) swap(l, r); P[K++] = {l, r - 1, i}; cnt[l + 1]++; }
+    }
+    partial_sum(cnt.begin(), cnt.end(), cnt.begin());
+    for (int i = 0; i < K; i++) S[cnt[P[i][0]]++] = P[i];
+    Policy::forRange(0, K, [&] (int lo, int hi) {
+      for (int i = lo; i < hi; i++)
+        ret[S[i][2]] = vert[FHS.query(S[i][0], S[i][1])];
+    }, 1 << 12);
+    return ret;
+  }
   bool connected(int v, int w) { return root[v] == root[w]; }
   T dist(int v, int w) { return dep[v] + dep[w] - 2 * dep[lca(v, w)]; }
 };
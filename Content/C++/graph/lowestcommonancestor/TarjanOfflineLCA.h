@@ -0,0 +1,82 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../../datastructures/unionfind/UnionFind.h"
+using namespace std;
+
+// Answers a batch of lowest common ancestor queries in a forest offline
+//   using Tarjan's algorithm, without building a range minimum query
+//   structure
+// The queries are grouped by vertex with a counting sort, and the forest is
+//   traversed with an explicit stack, where each finished vertex is merged
+//   into the set of its parent in a union find, whose ancestor is the
+//   parent, and each query is answered when its second vertex is finished
+// Vertices are 0-indexed
+// Constructor Arguments:
+//   G: a generic forest data structure (weighted or unweighted)
+//     Required Functions:
+//       operator [v] const: iterates over the adjacency list of vertex v
+//         (which is a list of ints for an unweighted forest, or a list of
+//         pair<int, T> for a weighted forest with weights of type T)
+//       size() const: returns the number of vertices in the forest
+//   queries: a vector of pairs of vertices
+//   rt: a single root vertex
+//   roots: a vector of root vertices for each connected component
+// Fields:
+//   root: vector of roots for the forest each vertex is in
+//   ans: a vector of the lowest common ancestor of each query, or -1 if the
+//     two vertices are not connected
+// In practice, has a moderate constant, and is usually slower than building
+//   an LCA and answering the batch with it
+// Time Complexity:
+//   constructor: O((V + Q) alpha V)
+// Memory Complexity: O(V + Q)
+// Tested:
+//   Fuzz and Stress Tested
+struct TarjanOfflineLCA {
+  int V; vector<int> root, ans;
+  static int getTo(int e) { return e; }
+  template <class T> static int getTo(const pair<int, T> &e) {
+    return e.first;
+  }
+  template <class Forest>
+  TarjanOfflineLCA(const Forest &G, const vector<pair<int, int>> &queries,
+                   const vector<int> &roots = vector<int>())
+      : V(G.size()), root(V, -1), ans(queries.size(), -1) {
+    int Q = queries.size(); vector<int> st(V + 1, 0), q(Q * 2), anc(V);
+    vector<bool> done(V, false); UnionFind uf(V);
+    for (auto &&p : queries) { st[p.first]++; st[p.second]++; }
+    partial_sum(st.begin(), st.end(), st.begin());
+    for (int i = 0; i < Q; i++) {
+      q[--st[queries[i].first]] = i; q[--st[queries[i].second]] = i;
+    }
+    using It = typename remove_const<decltype(G[0].begin())>::type;
+    struct Frame { int v, prev; It it, en; }; vector<Frame> stk;
+    auto push = [&] (int v, int prev) {
+      auto &&adj = G[v]; stk.push_back(Frame{v, prev, adj.begin(), adj.end()});
+      anc[v] = v;
+    };
+    auto dfs = [&] (int r) {
+      root[r] = r; push(r, -1); while (!stk.empty()) {
+        Frame &f = stk.back(); if (f.it != f.en) {
+          auto &&e = *f.it; ++f.it; int w = getTo(e);
+          if (w != f.prev) { root[w] = r; push(w, f.v); }
+          continue;
+        }
+        int v = f.v, p = f.prev; stk.pop_back(); done[v] = true;
+        for (int i = st[v]; i < st[v + 1]; i++) {
+          int a = queries[q[i]].first, b = queries[q[i]].second;
+          int u = a == v ? b : a;
+          if (done[u] && root[u] == r) ans[q[i]] = anc[uf.find(u)];
+        }
+        if (p != -1) { uf.join(p, v); anc[uf.find(p)] = p; }
+      }
+    };
+    if (roots.empty()) {
+      for (int v = 0; v < V; v++) if (root[v] == -1) dfs(v);
+    } else for (int v : roots) if (root[v] == -1) dfs(v);
+  }
+  template <class Forest>
+  TarjanOfflineLCA(const Forest &G, const vector<pair<int, int>> &queries,
+                   int rt)
+      : TarjanOfflineLCA(G, queries, vector<int>{rt}) {}
+};
@@ -0,0 +1,85 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../../datastructures/unionfind/UnionFindConcurrent.h"
+#include "../../utils/ThreadPool.h"
+using namespace std;
+
+// Computes the minimum spanning tree (or forest) using the Filter Kruskal
+//   algorithm on edges given as a structure of arrays
+// Each range of edge indices is partitioned around the median of a sample
+//   of its edges, and the lighter half is processed first, after which the
+//   edges in the heavier half that connect two vertices already in the same
+//   component are filtered out before it is processed, so most heavy edges
+//   are never sorted
+// Ranges with at most max(BASE, V) edges are sorted and processed with
+//   Kruskal's algorithm, and the partitions and filters are done in parallel
+//   chunks
+// Ties in weight are broken by the index of the edge, so the tree is unique
+//   and does not depend on the number of threads
+// Vertices are 0-indexed
+// Template Arguments:
+//   T: the type of the weight of the edges
+//   Policy: the execution policy for the partitions and filters, either
+//     SerialPolicy or ParallelPolicy
+// Constructor Arguments:
+//   V: number of vertices in the graph
+//   A: a vector of the first vertex of each undirected edge
+//   B: a vector of the second vertex of each undirected edge
+//   W: a vector of the weight of each undirected edge
+// Fields:
+//   mstWeight: the weight of the mst
+//   mstEdges: a vector of the indices of the edges in the mst, in increasing
+//     order of weight
+// In practice, has a small constant, faster than Kruskal, especially when
+//   E is much larger than V
+// Time Complexity:
+//   constructor: O(V + E log E) in the worst case, O(V log V + E) in
+//     practice for random graphs with E much larger than V
+// Memory Complexity: O(V + E)
+// Tested:
+//   Fuzz and Stress Tested
+template <class T, class Policy = SerialPolicy> struct FilterKruskalMST {
+  static constexpr int BASE = 1 << 12, SAMPLES = 63;
+  T mstWeight; vector<int> mstEdges; UnionFindConcurrent uf;
+  FilterKruskalMST(int V, const vector<int> &A, const vector<int> &B,
+                   const vector<T> &W)
+      : mstWeight(), uf(V) {
+    int E = A.size(); vector<int> ids(E), tmp(E), smp;
+    vector<pair<T, int>> buf; vector<array<int, 3>> stk;
+    iota(ids.begin(), ids.end(), 0); stk.push_back({0, E, 0});
+    auto lt = [&] (int e, int f) {
+      return W[e] < W[f] || (!(W[f] < W[e]) && e < f);
+    };
+    while (!stk.empty() && int(mstEdges.size()) < V - 1) {
+      int lo = stk.back()[0], hi = stk.back()[1];
+      bool filter = stk.back()[2]; stk.pop_back();
+      if (filter) hi = stablePartition<Policy>(ids, lo, hi, tmp, [&] (int e) {
+        return uf.find(A[e]) != uf.find(B[e]);
+      });
+      if (hi - lo <= max(int(BASE), V)) {
+        buf.clear(); for (int i = lo; i < hi; i++)
+          buf.emplace_back(W[ids[i]], ids[i]);
+        sort(buf.begin(), buf.end(), [&] (const pair<T, int> &p,
+                                          const pair<T, int> &q) {
+          return p.first < q.first
+              || (!(q.first < p.first) && p.second < q.second);
+        });
+        for (auto &&p : buf) {
+          if (int(mstEdges.size()) >= V - 1) break;
+          if (uf.join(A[p.second], B[p.second])) {
+            mstEdges.push_back(p.second); mstWeight += p.first;
+          }
+        }
+        continue;
+      }
+      smp.clear(); for (int k = 0; k < SAMPLES; k++)
+        smp.push_back(ids[lo + int((long long)(hi - lo) * k / SAMPLES)]);
+      nth_element(smp.begin(), smp.begin() + SAMPLES / 2, smp.end(), lt);
+      int piv = smp[SAMPLES / 2];
+      int mid = stablePartition<Policy>(ids, lo, hi, tmp, [&] (int e) {
+        return !lt(piv, e);
+      });
+      stk.push_back({mid, hi, 1}); stk.push_back({lo, mid, 0});
+    }
+  }
+};
@@ -0,0 +1,97 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../../datastructures/unionfind/UnionFindConcurrent.h"
+#include "../../utils/ThreadPool.h"
+using namespace std;
+
+// Computes the minimum spanning tree (or forest) using an edge centric
+//   parallel version of Boruvka's algorithm on edges given as a structure
+//   of arrays
+// Each round, the lightest edge leaving each component is found by
+//   processing the remaining edges in parallel and updating the edge stored
+//   at the root of both of its components with a compare and swap loop (an
+//   atomic minimum), and then the components are contracted by joining the
+//   endpoints of those edges in a concurrent union find
+// The edges that connect two vertices in the same component are filtered
+//   out in the same pass, the components with no remaining edges are
+//   dropped, and the union find is flattened after each round so that each
+//   find in the next round only follows a single parent pointer
+// Ties in weight are broken by the index of the edge, so the tree is unique
+//   and the result does not depend on the number of threads
+// Vertices are 0-indexed
+// Template Arguments:
+//   T: the type of the weight of the edges
+//   Policy: the execution policy for each round, either SerialPolicy or
+//     ParallelPolicy
+// Constructor Arguments:
+//   V: number of vertices in the graph
+//   A: a vector of the first vertex of each undirected edge
+//   B: a vector of the second vertex of each undirected edge
+//   W: a vector of the weight of each undirected edge
+// Fields:
+//   mstWeight: the weight of the mst
+//   mstEdges: a vector of the indices of the edges in the mst
+// In practice, about 1.5 to 2.5 times slower than BoruvkaMST on a single
+//   thread because of the atomic minimum and the concurrent union find, so
+//   it is only worth using with multiple threads
+// Time Complexity:
+//   constructor: O((V + E) log V) in the worst case, with each round split
+//     across P threads, and the number of edges processed usually decreases
+//     quickly between rounds
+// Memory Complexity: O(V + E)
+// Tested:
+//   Fuzz and Stress Tested
+template <class T, class Policy = SerialPolicy> struct ParallelBoruvkaMST {
+  T mstWeight; vector<int> mstEdges; UnionFindConcurrent uf;
+  ParallelBoruvkaMST(int V, const vector<int> &A, const vector<int> &B,
+                     const vector<T> &W)
+      : mstWeight(), uf(V) {
+    int E = A.size(); vector<int> ids(E), tmp(max(E, V)), best(V, -1);
+    vector<int> R(V), oth(V);
+    iota(ids.begin(), ids.end(), 0); iota(R.begin(), R.end(), 0);
+    auto lt = [&] (int e, int f) {
+      return W[e] < W[f] || (!(W[f] < W[e]) && e < f);
+    };
+    auto atomicMin = [&] (int v, int e) {
+      int old = __atomic_load_n(&best[v], __ATOMIC_RELAXED);
+      while ((old == -1 || lt(e, old)) && !__atomic_compare_exchange_n(
+          &best[v], &old, e, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    };
+    while (true) {
+      E = stablePartition<Policy>(ids, 0, E, tmp, [&] (int e) {
+        int a = uf.find(A[e]), b = uf.find(B[e]); if (a == b) return false;
+        atomicMin(a, e); atomicMin(b, e); return true;
+      });
+      if (E == 0) break;
+      R.resize(stablePartition<Policy>(R, 0, R.size(), tmp, [&] (int v) {
+        return best[v] != -1;
+      }));
+      int K = R.size(); Policy::forRange(0, K, [&] (int lo, int hi) {
+        for (int i = lo; i < hi; i++) {
+          int v = R[i], e = best[v], a = uf.find(A[e]), b = uf.find(B[e]);
+          oth[v] = a == v ? b : a;
+        }
+      }, 1 << 12);
+      Policy::forRange(0, K, [&] (int lo, int hi) {
+        for (int i = lo; i < hi; i++) {
+          int v = R[i], e = best[v], u = oth[v];
+          if (best[u] != e || v < u) uf.join(A[e], B[e]);
+          else oth[v] = -1;
+        }
+      }, 1 << 12);
+      for (int v : R) if (oth[v] != -1) {
+        mstEdges.push_back(best[v]); mstWeight += W[best[v]];
+      }
+      Policy::forRange(0, K, [&] (int lo, int hi) {
+        for (int i = lo; i < hi; i++) best[R[i]] = -1;
+      }, 1 << 12);
+      Policy::forRange(0, V, [&] (int lo, int hi) {
+        for (int v = lo; v < hi; v++)
+          __atomic_store_n(&uf.UF[v], uf.find(v), __ATOMIC_RELAXED);
+      }, 1 << 12);
+      R.resize(stablePartition<Policy>(R, 0, K, tmp, [&] (int v) {
+        return uf.UF[v] == v;
+      }));
+    }
+  }
+};
@@ -0,0 +1,176 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "PushRelabelMaxFlowCSR.h"
+using namespace std;
+
+// Computes the minimum cost flow satisfying the supplies of each vertex, or
+//   the minimum cost maximum flow, using the primal Network Simplex algorithm
+//   on runtime sized edge arrays
+// The spanning tree is stored with parent pointers, depths, and linked lists
+//   of children, and starts as a strongly feasible tree of artificial edges
+//   to an extra root vertex, which is kept strongly feasible by choosing the
+//   last blocking edge of each cycle as the leaving edge (which prevents
+//   cycling)
+// The entering edge is chosen with the block search pivot rule, which scans
+//   the edges in blocks of about sqrt(E) edges, continuing from where the
+//   last scan stopped, and picks the edge with the most negative reduced
+//   cost in the first block that has any
+// getMaxFlowMinCost first computes the maximum flow with
+//   PushRelabelMaxFlowCSR, and then the minimum cost flow with a supply of
+//   the maximum flow at the source and a demand at the sink
+// Negative cost cycles are handled, as long as every edge on them has a
+//   finite capacity
+// Vertices are 0-indexed
+// Template Arguments:
+//   flowUnit: the type of the capacity of each edge, which should be an
+//     integral type
+//   costUnit: the type of the cost of each edge, which should be an integral
+//     type large enough to store 4 (V + 1) times the maximum absolute value
+//     of the cost of an edge
+// Constructor Arguments:
+//   V: the number of vertices in the flow network
+// Fields:
+//   V: the number of vertices in the flow network
+//   E: the number of edges added
+//   A, B, CAP, COST, FLOW: the edges, where edge i goes from A[i] to B[i],
+//     has a capacity of CAP[i], a cost of COST[i], and a flow of FLOW[i] after
+//     the last call to getMinCostFlow or getMaxFlowMinCost
+//   pi: the potential of each vertex (and of the root in pi[V]) after the
+//     last call, which are optimal dual values if a feasible flow exists
+//   pivots: the total number of pivots done by every call so far
+// Functions:
+//   reserveEdges(maxEdges): reserves space for maxEdges edges
+//   addEdge(v, w, cap, cost): adds an edge from v to w with a capacity of
+//     cap and a cost of cost per unit of flow, and returns the index of the
+//     edge
+//   getMinCostFlow(supply): returns a pair of a boolean that is true if there
+//     is a flow where the net flow out of each vertex v is supply[v] (where
+//     the supplies must sum to 0), and the minimum cost of such a flow
+//   getMaxFlowMinCost(s, t): returns a pair of the maximum flow from s to t,
+//     and the minimum cost of a maximum flow
+//   getEdgeFlow(i): returns the flow on the i-th edge added
+// In practice, has a small constant, and usually needs far fewer than
+//   V E pivots
+// Time Complexity:
+//   constructor: O(1)
+//   addEdge: O(1) amortized
+//   getMinCostFlow, getMaxFlowMinCost: exponential in the worst case, with
+//     O(E) for each pivot, but usually O(sqrt E) for the block search plus
+//     the length of the cycle and the size of the subtree that is moved,
+//     much faster in practice
+//   getEdgeFlow: O(1)
+// Memory Complexity: O(V + E)
+// Tested:
+//   Fuzz and Stress Tested
+template <class flowUnit, class costUnit> struct NetworkSimplexMinCostFlow {
+  int V, E; long long pivots;
+  vector<int> A, B, par, pe, dep, fch, nsb, psb, stk;
+  vector<flowUnit> CAP, FLOW; vector<costUnit> COST, pi;
+  vector<signed char> state;
+  NetworkSimplexMinCostFlow(int V) : V(V), E(0), pivots(0) {}
+  void reserveEdges(int maxEdges) {
+    A.reserve(maxEdges); B.reserve(maxEdges); CAP.reserve(maxEdges);
+    COST.reserve(maxEdges); FLOW.reserve(maxEdges);
+  }
+  int addEdge(int v, int w, flowUnit cap, costUnit cost) {
+    A.push_back(v); B.push_back(w); CAP.push_back(cap); COST.push_back(cost);
+    FLOW.push_back(flowUnit()); return E++;
+  }
+  costUnit reduced(int e) const { return COST[e] + pi[A[e]] - pi[B[e]]; }
+  flowUnit up(int x) const {
+    int e = pe[x]; return A[e] == x ? CAP[e] - FLOW[e] : FLOW[e];
+  }
+  flowUnit down(int x) const {
+    int e = pe[x]; return A[e] == x ? FLOW[e] : CAP[e] - FLOW[e];
+  }
+  void detach(int x) {
+    if (psb[x] != -1) nsb[psb[x]] = nsb[x];
+    else fch[par[x]] = nsb[x];
+    if (nsb[x] != -1) psb[nsb[x]] = psb[x];
+  }
+  void attach(int x, int p) {
+    par[x] = p; psb[x] = -1; nsb[x] = fch[p];
+    if (nsb[x] != -1) psb[nsb[x]] = x;
+    fch[p] = x;
+  }
+  int entering(int &next, int blk) {
+    costUnit best = costUnit(); int in = -1;
+    for (int k = 0, cnt = blk; k < E; k++) {
+      int e = next; if (++next == E) next = 0;
+      if (state[e] != 0) {
+        costUnit c = state[e] > 0 ? reduced(e) : -reduced(e);
+        if (c < best) { best = c; in = e; }
+      }
+      if (--cnt == 0) { if (in != -1) return in; cnt = blk; }
+    }
+    return in;
+  }
+  void pivot(int in) {
+    int first = A[in], second = B[in], out = -1, j = first, k = second;
+    bool outFirst = false; if (state[in] < 0) swap(first, second);
+    flowUnit d = state[in] > 0 ? CAP[in] - FLOW[in] : FLOW[in];
+    while (j != k) {
+      if (dep[j] >= dep[k]) j = par[j];
+      else k = par[k];
+    }
+    for (int x = first; x != j; x = par[x]) if (down(x) < d) {
+      d = down(x); out = x; outFirst = true;
+    }
+    for (int x = second; x != j; x = par[x]) if (up(x) <= d) {
+      d = up(x); out = x; outFirst = false;
+    }
+    if (d > flowUnit()) {
+      FLOW[in] += state[in] > 0 ? d : -d;
+      for (int x = first; x != j; x = par[x])
+        FLOW[pe[x]] += A[pe[x]] == x ? -d : d;
+      for (int x = second; x != j; x = par[x])
+        FLOW[pe[x]] += A[pe[x]] == x ? d : -d;
+    }
+    if (out == -1) { state[in] = -state[in]; return; }
+    int oe = pe[out]; state[oe] = (A[oe] == out) == outFirst ? 1 : -1;
+    state[in] = 0; int x = outFirst ? first : second;
+    int p = outFirst ? second : first, e = in;
+    while (true) {
+      int q = par[x], f = pe[x]; detach(x); attach(x, p); pe[x] = e;
+      if (x == out) break;
+      p = x; e = f; x = q;
+    }
+    stk.assign(1, outFirst ? first : second); while (!stk.empty()) {
+      x = stk.back(); stk.pop_back(); dep[x] = dep[par[x]] + 1;
+      pi[x] = pi[par[x]] + (A[pe[x]] == x ? -COST[pe[x]] : COST[pe[x]]);
+      for (int y = fch[x]; y != -1; y = nsb[y]) stk.push_back(y);
+    }
+  }
+  pair<bool, costUnit> getMinCostFlow(const vector<flowUnit> &supply) {
+    costUnit mx = costUnit();
+    for (auto &&c : COST) mx = max(mx, c < 0 ? -c : c);
+    costUnit ART = mx * costUnit(V + 1) + 1;
+    flowUnit INF = numeric_limits<flowUnit>::max();
+    par.assign(V + 1, -1); pe.assign(V + 1, -1); dep.assign(V + 1, 0);
+    fch.assign(V + 1, -1); nsb.assign(V + 1, -1); psb.assign(V + 1, -1);
+    pi.assign(V + 1, costUnit()); state.assign(E + V, 0);
+    for (int e = 0; e < E; e++) { FLOW[e] = flowUnit(); state[e] = 1; }
+    for (int v = 0; v < V; v++) {
+      bool out = supply[v] >= flowUnit(); A.push_back(out ? v : V);
+      B.push_back(out ? V : v); CAP.push_back(INF); COST.push_back(ART);
+      FLOW.push_back(out ? supply[v] : -supply[v]);
+      attach(v, V); pe[v] = E + v; dep[v] = 1; pi[v] = out ? -ART : ART;
+    }
+    int next = 0, blk = max(int(sqrt(E)), 10);
+    for (int in; (in = entering(next, blk)) != -1; pivots++) pivot(in);
+    bool feasible = true; costUnit cost = costUnit();
+    for (int v = 0; v < V; v++)
+      if (FLOW[E + v] != flowUnit()) feasible = false;
+    for (int e = 0; e < E; e++) cost += COST[e] * costUnit(FLOW[e]);
+    A.resize(E); B.resize(E); CAP.resize(E); COST.resize(E); FLOW.resize(E);
+    return make_pair(feasible, cost);
+  }
+  pair<flowUnit, costUnit> getMaxFlowMinCost(int s, int t) {
+    PushRelabelMaxFlowCSR<flowUnit> mf(V); mf.reserveEdges(E);
+    for (int e = 0; e < E; e++) mf.addEdge(A[e], B[e], CAP[e]);
+    flowUnit maxFlow = mf.getFlow(s, t); vector<flowUnit> supply(V);
+    supply[s] += maxFlow; supply[t] -= maxFlow;
+    return make_pair(maxFlow, getMinCostFlow(supply).second);
+  }
+  flowUnit getEdgeFlow(int i) const { return FLOW[i]; }
+};
@@ -0,0 +1,402 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../../utils/ThreadPool.h"
+using namespace std;
+
+// Computes the maximum flow and minimum cut in a flow network using the
+//   Push Relabel algorithm on a runtime sized compressed sparse row arc
+//   array, where each arc stores the index of its paired reverse arc
+// The labels are periodically recomputed exactly with a global relabel
+//   (a breadth first search towards the sink in the residual graph, and
+//   then towards the source for the vertices that cannot reach the sink)
+// The first phase computes a maximum preflow by only discharging vertices
+//   with a label less than V, and the second phase returns the remaining
+//   excess to the source in a single pass, by cancelling the cycles of flow
+//   found by a depth first search along the arcs that carry flow into each
+//   vertex with excess, and then pushing the excess of each vertex back
+//   along the arcs that carry flow into it in reverse topological order, so
+//   the result is a flow rather than a preflow
+// With a single thread, active vertices are discharged with the highest
+//   label selection rule and the gap relabelling heuristic
+// With multiple threads, every active vertex is discharged in synchronous
+//   rounds, where the pushes in a round only use the labels from the start
+//   of the round (so an arc and its reverse arc are never both admissible),
+//   excess pushed into a vertex is accumulated with atomic additions and
+//   only applied after the round, and each vertex with remaining excess is
+//   relabelled after every push is done, so the flow value and the minimum
+//   cut do not depend on the number of threads
+// After a call to getFlow, the capacities can be changed with resolve,
+//   which keeps the flow from the previous solve, clamps the flow of each
+//   changed edge to its new capacities, and reroutes the clamped flow
+//   around the edge along shortest residual paths where possible, and
+//   otherwise cancels the resulting deficits along paths of flow to the
+//   sink, the source, or a vertex with excess, with a new search for each
+//   path
+// The excess from the clamped edges is then returned with the same single
+//   pass as getFlow, and the flow is augmented with blocking flows along
+//   shortest paths in the residual graph (as in Dinic's algorithm, with the
+//   distances from a global relabel) from the source, with a supply equal to
+//   the flow that was cancelled plus the total increase in capacity, which
+//   bounds the increase of the maximum flow
+// Vertices are 0-indexed
+// Template Arguments:
+//   unit: the type of the capacity of each edge
+//   Policy: the execution policy, either SerialPolicy or ParallelPolicy
+// Constructor Arguments:
+//   V: the number of vertices in the flow network
+//   EPS: a value for epsilon
+// Fields:
+//   V: the number of vertices in the flow network
+//   EPS: a value for epsilon
+//   ST, TO, REV, CAP, RES: the compressed sparse row arcs, where the arcs
+//     leaving vertex v are the indices in the range [ST[v], ST[v + 1]), and
+//     arc e goes to vertex TO[e], has a capacity of CAP[e], a residual
+//     capacity of RES[e], and a reverse arc REV[e]
+//   pos: the index of the arc from v to w for each edge added
+//   h: the label of each vertex
+//   ex: the excess of each vertex
+//   cut: a vector of booleans that is true for each vertex on the source
+//     side of the minimum cut (the vertices that cannot reach the sink in
+//     the residual graph)
+// Functions:
+//   reserveEdges(maxEdges): reserves space for maxEdges edges
+//   addEdge(v, w, vwCap, wvCap): adds an edge from v to w with capacity
+//     vwCap, and an edge from w to v with capacity wvCap sharing the same
+//     pair of arcs, and returns the index of the edge
+//   build(): builds the arc arrays from the edges that have been added,
+//     which is called by getFlow if it has not been called yet, after which
+//     no more edges can be added
+//   getFlow(s, t): returns the maximum flow from s to t, and sets cut
+//   resolve(deltas): for each tuple (i, dvw, dwv) in deltas, increases the
+//     capacity from v to w of the i-th edge added by dvw and the capacity
+//     from w to v by dwv (which may be negative, as long as the resulting
+//     capacities are not), and returns the maximum flow from the source to
+//     the sink of the last call to getFlow with the new capacities, and
+//     sets cut
+//   getEdgeFlow(i): returns the flow on the i-th edge added in the direction
+//     from v to w, which is negative if the net flow is from w to v
+// In practice, has a small constant, and the number of global relabels is
+//   usually small, and resolve is much faster than getFlow when the changes
+//   are small, but is never faster than a few passes over the graph
+// Time Complexity:
+//   constructor: O(V)
+//   addEdge: O(1) amortized
+//   build: O(V + E)
+//   getFlow: O(V^2 sqrt E) with a single thread, O(V^2 E) in total work
+//     with multiple threads, much faster in practice, where returning the
+//     excess takes O(V + E) plus O(V) for each cycle of flow cancelled
+//   resolve: O(V + E) for the final global relabel and for returning the
+//     excess, plus O(V + E) for each blocking flow phase and for each path
+//     that is found to reroute the flow of a changed edge or to cancel a
+//     deficit, so each call takes at least O(V + E) time, and the number of
+//     phases and paths is usually small when the changes are small
+//   getEdgeFlow: O(1)
+// Memory Complexity: O(V + E)
+// Tested:
+//   Fuzz and Stress Tested
+template <class unit, class Policy = SerialPolicy>
+struct PushRelabelMaxFlowCSR {
+  int V; unit EPS; bool built; long long work;
+  vector<int> A, B, ST, TO, REV, pos, h, nh, cur, anext, ahead, bnext, bprev;
+  vector<int> bhead; vector<unit> C, D, CAP, RES, ex, add;
+  vector<int> stk, it, par; vector<unsigned> vis; vector<char> mark;
+  vector<bool> cut; int bmax, top, S, T; unsigned stamp;
+  PushRelabelMaxFlowCSR(int V, unit EPS = unit())
+      : V(V), EPS(EPS), built(false), work(0), h(V), nh(V), cur(V),
+        anext(V), ahead(V + 1), bnext(V), bprev(V), bhead(V + 1),
+        ex(V), add(V), it(V), par(V), vis(V, 0), mark(V, 0),
+        cut(V, false), S(0), T(0), stamp(0) {}
+  void reserveEdges(int maxEdges) {
+    A.reserve(maxEdges); B.reserve(maxEdges);
+    C.reserve(maxEdges); D.reserve(maxEdges);
+  }
+  int addEdge(int v, int w, unit vwCap, unit wvCap = unit()) {
+    A.push_back(v); B.push_back(w); C.push_back(vwCap); D.push_back(wvCap);
+    return int(A.size()) - 1;
+  }
+  void build() {
+    int M = A.size(); ST.assign(V + 1, 0); TO.resize(M * 2);
+    REV.resize(M * 2); CAP.resize(M * 2); pos.resize(M);
+    for (int i = 0; i < M; i++) { ST[A[i]]++; ST[B[i]]++; }
+    partial_sum(ST.begin(), ST.end(), ST.begin());
+    for (int i = M - 1; i >= 0; i--) {
+      int a = --ST[A[i]], b = --ST[B[i]]; pos[i] = a;
+      TO[a] = B[i]; TO[b] = A[i]; REV[a] = b; REV[b] = a;
+      CAP[a] = C[i]; CAP[b] = D[i];
+    }
+    RES = CAP; built = true;
+  }
+  static void atomicAdd(unit &x, unit d) {
+    unit old, val; __atomic_load(&x, &old, __ATOMIC_RELAXED);
+    do { val = old + d; } while (!__atomic_compare_exchange(
+        &x, &old, &val, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+  }
+  void globalRelabel(int s, int t, bool fixSource = true) {
+    fill(h.begin(), h.end(), V * 2); h[t] = 0; if (fixSource) h[s] = V;
+    mutex mtx; for (int src : {t, s}) {
+      vector<int> F{src}, N; if (src == s && h[s] == V * 2) h[s] = V;
+      for (int lvl = h[src] + 1; !F.empty(); lvl++, F.swap(N)) {
+        N.clear(); Policy::forRange(0, int(F.size()), [&] (int lo, int hi) {
+          vector<int> loc; for (int i = lo; i < hi; i++) {
+            int u = F[i]; for (int e = ST[u]; e < ST[u + 1]; e++) {
+              int x = TO[e], old = V * 2; if (RES[REV[e]] > EPS
+                  && __atomic_load_n(&h[x], __ATOMIC_RELAXED) == old
+                  && __atomic_compare_exchange_n(&h[x], &old, lvl, false,
+                                                 __ATOMIC_RELAXED,
+                                                 __ATOMIC_RELAXED))
+                loc.push_back(x);
+            }
+          }
+          lock_guard<mutex> lock(mtx);
+          N.insert(N.end(), loc.begin(), loc.end());
+        }, 1 << 10);
+      }
+    }
+    for (int v = 0; v < V; v++) cur[v] = ST[v];
+    work = 0;
+  }
+  void saturate(int s) {
+    for (int e = ST[s]; e < ST[s + 1]; e++) if (RES[e] > EPS && h[TO[e]] < V) {
+      ex[TO[e]] += RES[e]; ex[s] -= RES[e]; RES[REV[e]] += RES[e]; RES[e] = 0;
+    }
+  }
+  bool active(int v, int s, int t) const {
+    return v != s && v != t && ex[v] > EPS && h[v] < V;
+  }
+  void activate(int v) {
+    anext[v] = ahead[h[v]]; ahead[h[v]] = v; top = max(top, h[v]);
+  }
+  void binsert(int v) {
+    bprev[v] = -1; bnext[v] = bhead[h[v]];
+    if (bnext[v] != -1) bprev[bnext[v]] = v;
+    bhead[h[v]] = v; bmax = max(bmax, h[v]);
+  }
+  void berase(int v) {
+    if (bprev[v] == -1) bhead[h[v]] = bnext[v];
+    else bnext[bprev[v]] = bnext[v];
+    if (bnext[v] != -1) bprev[bnext[v]] = bprev[v];
+  }
+  void buckets(int s, int t) {
+    fill(ahead.begin(), ahead.end(), -1); fill(bhead.begin(), bhead.end(), -1);
+    top = bmax = 0; for (int v = 0; v < V; v++) if (v != s && v != t) {
+      if (h[v] < V) binsert(v);
+      if (active(v, s, t)) activate(v);
+    }
+  }
+  void relabel(int v) {
+    int old = h[v], nw = V * 2; for (int e = ST[v]; e < ST[v + 1]; e++)
+      if (RES[e] > EPS && h[TO[e]] + 1 < nw) { nw = h[TO[e]] + 1; cur[v] = e; }
+    work += ST[v + 1] - ST[v] + 12; if (old < V) {
+      berase(v); if (bhead[old] == -1) {
+        for (int k = old + 1; k <= bmax; k++) {
+          for (int x = bhead[k]; x != -1; x = bnext[x]) {
+            h[x] = V + 1; cur[x] = ST[x];
+          }
+          bhead[k] = -1;
+        }
+        bmax = old - 1; nw = max(nw, V + 1);
+      }
+    }
+    if ((h[v] = min(nw, V * 2)) < V) binsert(v);
+  }
+  void discharge(int v, int s, int t) {
+    while (ex[v] > EPS) {
+      if (cur[v] == ST[v + 1]) {
+        relabel(v); if (h[v] >= V) break;
+        continue;
+      }
+      int e = cur[v], w = TO[e];
+      if (RES[e] <= EPS || h[v] != h[w] + 1) { cur[v]++; continue; }
+      unit d = min(ex[v], RES[e]); RES[e] -= d; RES[REV[e]] += d;
+      ex[v] -= d; bool was = ex[w] > EPS; ex[w] += d;
+      if (!was && active(w, s, t)) activate(w);
+    }
+  }
+  void runSerial(int s, int t, long long freq) {
+    buckets(s, t); while (true) {
+      while (top >= 0 && ahead[top] == -1) top--;
+      if (top < 0) break;
+      int v = ahead[top]; ahead[top] = anext[v];
+      if (h[v] < V && ex[v] > EPS) discharge(v, s, t);
+      if (work > freq) { globalRelabel(s, t); buckets(s, t); }
+    }
+  }
+  void runParallel(int s, int t, long long freq) {
+    vector<int> F, N; mutex mtx;
+    for (int v = 0; v < V; v++) if (active(v, s, t)) F.push_back(v);
+    while (!F.empty()) {
+      if (work > freq) {
+        globalRelabel(s, t); N.clear();
+        for (int v : F) if (active(v, s, t)) N.push_back(v);
+        F.swap(N); if (F.empty()) break;
+      }
+      N.clear(); Policy::forRange(0, int(F.size()), [&] (int lo, int hi) {
+        vector<int> loc; for (int i = lo; i < hi; i++) {
+          int v = F[i]; for (int &e = cur[v]; e < ST[v + 1]; e++) {
+            int w = TO[e]; if (h[v] != h[w] + 1 || RES[e] <= EPS) continue;
+            unit d = min(ex[v], RES[e]); RES[e] -= d; RES[REV[e]] += d;
+            ex[v] -= d; if (w == s || w == t) atomicAdd(ex[w], d);
+            else {
+              atomicAdd(add[w], d);
+              if (!__atomic_exchange_n(&mark[w], 1, __ATOMIC_RELAXED))
+                loc.push_back(w);
+            }
+            if (ex[v] <= EPS) break;
+          }
+        }
+        lock_guard<mutex> lock(mtx); N.insert(N.end(), loc.begin(), loc.end());
+      }, 1 << 6);
+      Policy::forRange(0, int(F.size()), [&] (int lo, int hi) {
+        long long cnt = 0; for (int i = lo; i < hi; i++) {
+          int v = F[i]; nh[v] = h[v]; if (ex[v] <= EPS) continue;
+          nh[v] = V * 2; cnt += ST[v + 1] - ST[v] + 12;
+          for (int e = ST[v]; e < ST[v + 1]; e++)
+            if (RES[e] > EPS && h[TO[e]] + 1 < nh[v]) {
+              nh[v] = h[TO[e]] + 1; cur[v] = e;
+            }
+          nh[v] = min(nh[v], V * 2);
+        }
+        __atomic_add_fetch(&work, cnt, __ATOMIC_RELAXED);
+      }, 1 << 6);
+      for (int v : F) {
+        h[v] = nh[v]; if (ex[v] > EPS && !mark[v]) {
+          mark[v] = 1; N.push_back(v);
+        }
+      }
+      Policy::forRange(0, int(N.size()), [&] (int lo, int hi) {
+        for (int i = lo; i < hi; i++) {
+          int w = N[i]; ex[w] += add[w]; add[w] = unit(); mark[w] = 0;
+        }
+      }, 1 << 10);
+      F.clear(); for (int v : N) if (active(v, s, t)) F.push_back(v);
+    }
+  }
+  void augment(int s, int t, unit supply) {
+    while (supply > EPS) {
+      globalRelabel(s, t, false); if (h[s] >= V) return;
+      while (supply > EPS && h[s] < V) {
+        stk.assign(1, s); while (!stk.empty() && stk.back() != t) {
+          int x = stk.back(), &e = cur[x];
+          while (e < ST[x + 1] && (RES[e] <= EPS || h[x] != h[TO[e]] + 1)) e++;
+          if (e == ST[x + 1]) { h[x] = V * 2; stk.pop_back(); }
+          else stk.push_back(TO[e]);
+        }
+        if (stk.empty()) break;
+        unit d = supply; for (int i = 0; i + 1 < int(stk.size()); i++)
+          d = min(d, RES[cur[stk[i]]]);
+        for (int i = 0; i + 1 < int(stk.size()); i++) {
+          RES[cur[stk[i]]] -= d; RES[REV[cur[stk[i]]]] += d;
+        }
+        supply -= d; ex[s] -= d; ex[t] += d;
+      }
+    }
+  }
+  void reroute(int w, int s, int t) {
+    while (-ex[w] > EPS) {
+      if (++stamp == 0) { fill(vis.begin(), vis.end(), 0); stamp = 1; }
+      stk.assign(1, w); vis[w] = stamp; it[w] = ST[w]; int y = -1;
+      while (y == -1 && !stk.empty()) {
+        int x = stk.back();
+        if (it[x] == ST[x + 1]) { stk.pop_back(); continue; }
+        int e = it[x]++, z = TO[e];
+        if (CAP[e] - RES[e] <= EPS || vis[z] == stamp) continue;
+        vis[z] = stamp; par[z] = e;
+        if (z == s || z == t || ex[z] > EPS) y = z;
+        else { it[z] = ST[z]; stk.push_back(z); }
+      }
+      if (y == -1) return;
+      unit d = -ex[w]; if (y != s && y != t) d = min(d, ex[y]);
+      for (int z = y; z != w; z = TO[REV[par[z]]])
+        d = min(d, CAP[par[z]] - RES[par[z]]);
+      ex[w] += d; ex[y] -= d;
+      for (int z = y; z != w; z = TO[REV[par[z]]]) {
+        RES[par[z]] += d; RES[REV[par[z]]] -= d;
+      }
+    }
+  }
+  void drain(int s, int t) {
+    auto in = [&] (int e) { return RES[e] - CAP[e]; };
+    vector<int> ord; mark[s] = mark[t] = 2;
+    for (int v = 0; v < V; v++) it[v] = ST[v];
+    for (int v = 0; v < V; v++) if (ex[v] > EPS && mark[v] == 0) {
+      stk.assign(1, v); mark[v] = 1; while (!stk.empty()) {
+        int x = stk.back(); if (it[x] == ST[x + 1]) {
+          mark[x] = 2; ord.push_back(x); stk.pop_back();
+          if (!stk.empty()) it[stk.back()]++;
+          continue;
+        }
+        int e = it[x], z = TO[e];
+        if (in(e) <= EPS || mark[z] == 2) { it[x]++; continue; }
+        if (mark[z] == 0) { mark[z] = 1; stk.push_back(z); continue; }
+        int k = int(stk.size()) - 1; unit d = in(e);
+        while (stk[k] != z) { k--; d = min(d, in(it[stk[k]])); }
+        RES[e] -= d; RES[REV[e]] += d;
+        for (int j = k; j + 1 < int(stk.size()); j++) {
+          RES[it[stk[j]]] -= d; RES[REV[it[stk[j]]]] += d;
+        }
+        for (int j = k + 1; j < int(stk.size()); j++) mark[stk[j]] = 0;
+        stk.resize(k + 1);
+      }
+    }
+    for (int i = int(ord.size()) - 1; i >= 0; i--) {
+      int x = ord[i]; mark[x] = 0;
+      for (int e = ST[x]; e < ST[x + 1] && ex[x] > EPS; e++) {
+        unit d = min(ex[x], in(e)); if (d <= EPS) continue;
+        RES[e] -= d; RES[REV[e]] += d; ex[x] -= d; ex[TO[e]] += d;
+      }
+    }
+    mark[s] = mark[t] = 0;
+  }
+  void bypass(int v, int w, unit &d) {
+    while (d > EPS) {
+      if (++stamp == 0) { fill(vis.begin(), vis.end(), 0); stamp = 1; }
+      stk.assign(1, v); vis[v] = stamp;
+      for (int front = 0; front < int(stk.size()) && vis[w] != stamp;
+           front++) {
+        int x = stk[front]; for (int e = ST[x]; e < ST[x + 1]; e++) {
+          int z = TO[e]; if (RES[e] <= EPS || vis[z] == stamp) continue;
+          vis[z] = stamp; par[z] = e; stk.push_back(z);
+        }
+      }
+      if (vis[w] != stamp) return;
+      unit f = d; for (int z = w; z != v; z = TO[REV[par[z]]])
+        f = min(f, RES[par[z]]);
+      for (int z = w; z != v; z = TO[REV[par[z]]]) {
+        RES[par[z]] -= f; RES[REV[par[z]]] += f;
+      }
+      d -= f;
+    }
+  }
+  unit finish(int s, int t) {
+    globalRelabel(s, t); for (int v = 0; v < V; v++) cut[v] = h[v] >= V;
+    drain(s, t); return ex[t];
+  }
+  unit getFlow(int s, int t) {
+    if (!built) build();
+    S = s; T = t; fill(cut.begin(), cut.end(), false);
+    if (s == t) return unit();
+    RES = CAP; fill(ex.begin(), ex.end(), unit());
+    long long freq = (6LL * V + ST[V]) / 2; globalRelabel(s, t); saturate(s);
+    if (Policy::threads() > 1) runParallel(s, t, freq);
+    else runSerial(s, t, freq);
+    return finish(s, t);
+  }
+  unit resolve(const vector<tuple<int, unit, unit>> &deltas) {
+    int s = S, t = T; if (s == t) return unit();
+    vector<int> touched; unit supply = ex[t];
+    for (auto &&d : deltas) {
+      int a = pos[get<0>(d)], b = REV[a], v = TO[b], w = TO[a];
+      unit f = CAP[a] - RES[a]; CAP[a] += get<1>(d); CAP[b] += get<2>(d);
+      unit g = max(min(f, CAP[a]), -CAP[b]), r = f - g;
+      RES[a] = CAP[a] - g; RES[b] = CAP[b] + g;
+      if (r > EPS) bypass(v, w, r);
+      else if (r < -EPS) { r = -r; bypass(w, v, r); r = -r; }
+      ex[v] += r; ex[w] -= r;
+      supply += max(get<1>(d), unit()) + max(get<2>(d), unit());
+      touched.push_back(v); touched.push_back(w);
+    }
+    for (int v : touched) if (v != s && v != t) reroute(v, s, t);
+    drain(s, t); augment(s, t, supply - ex[t]); return finish(s, t);
+  }
+  unit getEdgeFlow(int i) const { return CAP[pos[i]] - RES[pos[i]]; }
+};
@@ -4,32 +4,44 @@ using namespace std;
 
 // Computes the maximum flow using a path with the minimum cost using the Push Relabel algorithm with look ahead heuristics
 // Adds circulations to negative cost cycles
+// Runtime sized, with the same constructor, addEdge, getMaxFlowMinCost, and getEdgeFlow interface as
+//   NetworkSimplexMinCostFlow and SAPMinCostMaxFlow
+// If s or t is -1, getMaxFlowMinCost only computes the minimum cost circulation
+// getEdgeFlow(i) returns the flow on the i-th edge added (including self loops) after the last call to getMaxFlowMinCost
+// The total number of pushes done by every call so far is counted in pushes
 // Time Complexity: O(E V^2 log (V * C)), much faster in practice
 // Memory Complexity: O(V + E)
-template <const int MAXV, class flowUnit, class costUnit, const int SCALE = 8> struct PushRelabelMinCostMaxFlow {
+template <class flowUnit, class costUnit, const int SCALE = 8> struct PushRelabelMinCostMaxFlow {
     struct Edge {
         int to; flowUnit cap, resCap; costUnit cost; int rev;
         Edge(int to, flowUnit cap, costUnit cost, int rev) : to(to), cap(cap), resCap(cap), cost(cost), rev(rev) {}
     };
-    int cnt[MAXV * 2], h[MAXV], stk[MAXV], top; flowUnit FLOW_EPS, ex[MAXV]; costUnit COST_INF, COST_EPS, phi[MAXV], bnd, negCost;
-    vector<int> hs[MAXV * 2]; vector<Edge> adj[MAXV]; typename vector<Edge>::iterator cur[MAXV];
-    PushRelabelMinCostMaxFlow(flowUnit FLOW_EPS, costUnit COST_INF, costUnit COST_EPS) : FLOW_EPS(FLOW_EPS), COST_INF(COST_INF), COST_EPS(COST_EPS) {}
-    void addEdge(int v, int w, flowUnit flow, costUnit cost) {
+    int V, top; long long pushes; flowUnit FLOW_EPS; costUnit COST_INF, COST_EPS, bnd, negCost; vector<int> cnt, h, stk; vector<flowUnit> ex; vector<costUnit> phi;
+    vector<vector<int>> hs; vector<vector<Edge>> adj; vector<typename vector<Edge>::iterator> cur; vector<pair<int, int>> pos; vector<Edge> loops;
+    PushRelabelMinCostMaxFlow(int V, flowUnit FLOW_EPS, costUnit COST_INF, costUnit COST_EPS)
+        : V(V), pushes(0), FLOW_EPS(FLOW_EPS), COST_INF(COST_INF), COST_EPS(COST_EPS), negCost(0), cnt(V * 2), h(V), stk(V), ex(V), phi(V), hs(V * 2), adj(V), cur(V) {}
+    void reserveEdges(int maxEdges) { pos.reserve(maxEdges); }
+    int addEdge(int v, int w, flowUnit flow, costUnit cost) {
         if (v == w) {
-            if (cost < 0) negCost += flow * cost;
-            return;
+            pos.emplace_back(-1, int(loops.size())); loops.emplace_back(v, flow, cost, -1);
+            if (cost < 0) { negCost += flow * cost; loops.back().resCap = 0; }
+        } else {
+            pos.emplace_back(v, int(adj[v].size()));
+            adj[v].emplace_back(w, flow, cost, int(adj[w].size())); adj[w].emplace_back(v, 0, -cost, int(adj[v].size()) - 1);
         }
-        adj[v].emplace_back(w, flow, cost, int(adj[w].size())); adj[w].emplace_back(v, 0, -cost, int(adj[v].size()) - 1);
+        return int(pos.size()) - 1;
     }
-    void init(int V) { negCost = 0; for (int v = 0; v < V; v++) adj[v].clear(); }
-    flowUnit getFlow(int V, int s, int t) {
+    flowUnit getEdgeFlow(int i) const {
+        const Edge &e = pos[i].first == -1 ? loops[pos[i].second] : adj[pos[i].first][pos[i].second]; return e.cap - e.resCap;
+    }
+    flowUnit getFlow(int s, int t) {
         auto push = [&] (int v, Edge &e, flowUnit df) {
             int w = e.to;
             if (abs(ex[w]) <= FLOW_EPS && df > FLOW_EPS) hs[h[w]].push_back(w);
-            e.resCap -= df; adj[w][e.rev].resCap += df; ex[v] -= df; ex[w] += df;
+            e.resCap -= df; adj[w][e.rev].resCap += df; ex[v] -= df; ex[w] += df; pushes++;
         };
         if (s == t) return 0;
-        fill(h, h + V, 0); h[s] = V; fill(ex, ex + V, 0); ex[t] = 1; fill(cnt, cnt + V * 2, 0); cnt[0] = V - 1;
+        fill(h.begin(), h.end(), 0); h[s] = V; fill(ex.begin(), ex.end(), 0); ex[t] = 1; fill(cnt.begin(), cnt.end(), 0); cnt[0] = V - 1;
         for (int v = 0; v < V; v++) cur[v] = adj[v].begin();
         for (int i = 0; i < V * 2; i++) hs[i].clear();
         for (auto &&e : adj[s]) push(s, e, e.resCap);
@@ -50,11 +62,11 @@ template <const int MAXV, class flowUnit, class costUnit, const int SCALE = 8> s
         }
         return -ex[s];
     }
-    pair<flowUnit, costUnit> getFlowMinCost(int V, int s = -1, int t = -1) {
+    pair<flowUnit, costUnit> getMaxFlowMinCost(int s = -1, int t = -1) {
         auto costP = [&] (int v, const Edge &e) { return e.cost + phi[v] - phi[e.to]; };
         auto push = [&] (int v, Edge &e, flowUnit df, bool pushToStack) {
             if (e.resCap < df) df = e.resCap;
-            int w = e.to; e.resCap -= df; adj[w][e.rev].resCap += df; ex[v] -= df; ex[w] += df;
+            int w = e.to; e.resCap -= df; adj[w][e.rev].resCap += df; ex[v] -= df; ex[w] += df; pushes++;
             if (pushToStack && FLOW_EPS < ex[e.to] && ex[e.to] <= df + FLOW_EPS) stk[top++] = e.to;
         };
         auto relabel = [&] (int v, costUnit delta) { phi[v] -= delta + bnd; };
@@ -84,7 +96,7 @@ template <const int MAXV, class flowUnit, class costUnit, const int SCALE = 8> s
         };
         costUnit minCost = 0, mul = 2 << __lg(V); bnd = 0;
         for (int v = 0; v < V; v++) for (auto &&e : adj[v]) { minCost += e.cost * e.resCap; e.cost *= mul; bnd = max(bnd, e.cost); }
-        flowUnit maxFlow = (s == -1 || t == -1) ? 0 : getFlow(V, s, t); fill(phi, phi + V, 0); fill(ex, ex + V, 0);
+        flowUnit maxFlow = (s == -1 || t == -1) ? 0 : getFlow(s, t); fill(phi.begin(), phi.end(), 0); fill(ex.begin(), ex.end(), 0);
         while (bnd > 1) {
             bnd = max(bnd / SCALE, costUnit(1)); top = 0;
             for (int v = 0; v < V; v++) for (auto &&e : adj[v]) if (costP(v, e) < -COST_EPS && e.resCap > FLOW_EPS) push(v, e, e.resCap, false);
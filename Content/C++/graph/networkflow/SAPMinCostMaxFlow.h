@@ -5,31 +5,43 @@ using namespace std;
 using namespace __gnu_pbds;
 
 // Computes the maximum flow using a path with the minimum cost by finding Shortest Augmenting Paths
-// Unable to deal with negative cost cycles
+// Unable to deal with negative cost cycles, and self loops are ignored
+// Runtime sized, with the same constructor, addEdge, getMaxFlowMinCost, and getEdgeFlow interface as
+//   NetworkSimplexMinCostFlow and PushRelabelMinCostMaxFlow
+// getEdgeFlow(i) returns the flow on the i-th edge added after the last call to getMaxFlowMinCost
+// The total number of augmenting paths found by every call so far is counted in augments
 // Time Complexity: O(E^2 V log V), much faster in practice
 // Memory Complexity: O(V + E)
-template <const int MAXV, class flowUnit, class costUnit> struct SAPMinCostMaxFlow {
-    flowUnit FLOW_INF, FLOW_EPS; costUnit COST_INF; bool hasNegativeEdgeCost;
+template <class flowUnit, class costUnit> struct SAPMinCostMaxFlow {
+    int V; flowUnit FLOW_INF, FLOW_EPS; costUnit COST_INF; bool hasNegativeEdgeCost; long long augments;
     using heap = __gnu_pbds::priority_queue<pair<costUnit, int>, greater<pair<costUnit, int>>, pairing_heap_tag>;
-    SAPMinCostMaxFlow(flowUnit FLOW_INF, flowUnit FLOW_EPS, costUnit COST_INF) : FLOW_INF(FLOW_INF), FLOW_EPS(FLOW_EPS), COST_INF(COST_INF) {}
     struct Edge {
         int to; flowUnit cap, resCap; costUnit cost; int rev;
         Edge(int to, flowUnit cap, costUnit cost, int rev) : to(to), cap(cap), resCap(cap), cost(cost), rev(rev) {}
     };
-    int prev[MAXV]; Edge *to[MAXV]; costUnit phi[MAXV], dist[MAXV]; vector<Edge> adj[MAXV]; typename heap::point_iterator ptr[MAXV];
-    void addEdge(int v, int w, flowUnit flow, costUnit cost) {
-        if (v == w) return;
+    vector<int> prev; vector<Edge*> to; vector<costUnit> phi, dist; vector<vector<Edge>> adj; vector<typename heap::point_iterator> ptr; vector<pair<int, int>> pos;
+    SAPMinCostMaxFlow(int V, flowUnit FLOW_INF, flowUnit FLOW_EPS, costUnit COST_INF)
+        : V(V), FLOW_INF(FLOW_INF), FLOW_EPS(FLOW_EPS), COST_INF(COST_INF), hasNegativeEdgeCost(false), augments(0), prev(V), to(V), phi(V), dist(V), adj(V), ptr(V) {}
+    void reserveEdges(int maxEdges) { pos.reserve(maxEdges); }
+    int addEdge(int v, int w, flowUnit flow, costUnit cost) {
+        if (v == w) { pos.emplace_back(-1, -1); return int(pos.size()) - 1; }
         if (cost < 0) hasNegativeEdgeCost = true;
+        pos.emplace_back(v, int(adj[v].size()));
         adj[v].emplace_back(w, flow, cost, int(adj[w].size())); adj[w].emplace_back(v, 0, -cost, int(adj[v].size()) - 1);
+        return int(pos.size()) - 1;
     }
-    void bellmanFord(int V, int s) {
-        fill(phi, phi + V, COST_INF); phi[s] = 0;
+    flowUnit getEdgeFlow(int i) const {
+        if (pos[i].first == -1) return 0;
+        const Edge &e = adj[pos[i].first][pos[i].second]; return e.cap - e.resCap;
+    }
+    void bellmanFord(int s) {
+        fill(phi.begin(), phi.end(), COST_INF); phi[s] = 0;
         for (int j = 0; j < V - 1; j++) for (int v = 0; v < V; v++) for (auto &&e : adj[v])
             if (e.resCap > FLOW_EPS) phi[e.to] = min(phi[e.to], phi[v] + e.cost);
     }
-    bool dijkstra(int V, int s, int t) {
-        fill(dist, dist + V, COST_INF); fill(prev, prev + V, -1);
-        heap PQ; fill(ptr, ptr + V, PQ.end()); ptr[s] = PQ.push({dist[s] = 0, s});
+    bool dijkstra(int s, int t) {
+        fill(dist.begin(), dist.end(), COST_INF); fill(prev.begin(), prev.end(), -1);
+        heap PQ; fill(ptr.begin(), ptr.end(), PQ.end()); ptr[s] = PQ.push({dist[s] = 0, s});
         while (!PQ.empty()) {
             int v = PQ.top().second; PQ.pop();
             for (auto &&e : adj[v]) {
@@ -43,14 +55,13 @@ template <const int MAXV, class flowUnit, class costUnit> struct SAPMinCostMaxFl
         }
         return dist[t] != COST_INF;
     }
-    void init(int V) { hasNegativeEdgeCost = false; for (int v = 0; v < V; v++) adj[v].clear(); }
-    pair<flowUnit, costUnit> getMaxFlowMinCost(int V, int s, int t) {
-        flowUnit maxFlow = 0; costUnit minCost = 0; fill(phi, phi + V, 0);
-        if (hasNegativeEdgeCost) bellmanFord(V, s);
-        while (dijkstra(V, s, t)) {
+    pair<flowUnit, costUnit> getMaxFlowMinCost(int s, int t) {
+        flowUnit maxFlow = 0; costUnit minCost = 0; fill(phi.begin(), phi.end(), 0);
+        if (hasNegativeEdgeCost) bellmanFord(s);
+        while (dijkstra(s, t)) {
             flowUnit aug = FLOW_INF;
             for (int cur = t; prev[cur] != -1; cur = prev[cur]) aug = min(aug, to[cur]->resCap);
-            maxFlow += aug;
+            maxFlow += aug; augments++;
             for (int cur = t; prev[cur] != -1; cur = prev[cur]) {
                 to[cur]->resCap -= aug; adj[to[cur]->to][to[cur]->rev].resCap += aug; minCost += aug * to[cur]->cost;
             }
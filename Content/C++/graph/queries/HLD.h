@@ -1,10 +1,12 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../search/DepthFirstStack.h"
 using namespace std;
 
 // Decomposes a tree into chains, such that a path from any vertex to the root
 //   will cover at most O(log V) chains
 // Can be used with PathQueries.h for path queries
+// Both depth first traversals use an explicit stack
 // Vertices and indices are 0-indexed
 // Constructor Arguments:
 //   G: a generic forest data structure
@@ -44,19 +46,36 @@ using namespace std;
 //   https://judge.yosupo.jp/problem/vertex_set_path_composite
 struct HLD {
   int V, ind; vector<int> root, dep, par, size, head, pre, post, vert;
-  template <class Forest>
-  void dfs(const Forest &G, int v, int prev, int r, int d) {
-    root[v] = r; dep[v] = d; par[v] = prev; size[v] = 1; for (int w : G[v])
-      if (w != prev) { dfs(G, w, v, r, d + 1); size[v] += size[w]; }
+  template <class Forest> void dfs(DFSStack<Forest> &S, int r) {
+    root[r] = r; dep[r] = 0; par[r] = -1; size[r] = 1; S.push(r);
+    while (!S.empty()) {
+      int v = S.top(), w; if (S.next(w)) {
+        if (w != par[v]) {
+          root[w] = r; dep[w] = dep[v] + 1; par[w] = v; size[w] = 1;
+          S.push(w);
+        }
+        continue;
+      }
+      S.pop(); if (par[v] != -1) size[par[v]] += size[v];
+    }
+  }
+  template <class Forest> void enter(DFSStack<Forest> &S, int v) {
+    for (int heavy; v != -1; v = heavy) {
+      if (head[v] == -1) head[v] = v;
+      vert[pre[v] = ++ind] = v; heavy = -1; int prev = par[v];
+      for (int w : S.G[v])
+        if (w != prev && (heavy == -1 || size[heavy] < size[w])) heavy = w;
+      S.push(v, heavy); if (heavy != -1) head[heavy] = head[v];
+    }
   }
-  template <class Forest> void hld(const Forest &G, int v, int prev) {
-    if (head[v] == -1) head[v] = v;
-    vert[pre[v] = ++ind] = v; int heavy = -1;
-    for (int w : G[v]) if (w != prev && (heavy == -1 || size[heavy] < size[w]))
-      heavy = w;
-    if (heavy != -1) { head[heavy] = head[v]; hld(G, heavy, v); }
-    for (int w : G[v]) if (w != prev && w != heavy) hld(G, w, v);
-    post[v] = ind;
+  template <class Forest> void hld(DFSStack<Forest> &S, int r) {
+    enter(S, r); while (!S.empty()) {
+      int v = S.top(), w; if (S.next(w)) {
+        if (w != par[v] && w != S.val()) enter(S, w);
+        continue;
+      }
+      S.pop(); post[v] = ind;
+    }
   }
   int lca(int v, int w) {
     while (head[v] != head[w]) {
@@ -82,7 +101,7 @@ struct HLD {
   template <class Forest> HLD(const Forest &G)
       : V(G.size()), ind(-1), root(V, -1), dep(V), par(V), size(V),
         head(V, -1), pre(V), post(V), vert(V) {
-    for (int v = 0; v < V; v++)
-      if (root[v] == -1) { dfs(G, v, -1, v, 0); hld(G, v, -1); }
+    DFSStack<Forest> S(G); for (int v = 0; v < V; v++)
+      if (root[v] == -1) { dfs(S, v); hld(S, v); }
   }
 };
@@ -0,0 +1,174 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "StaticGraph.h"
+using namespace std;
+
+// Orderings of the vertices of a static graph that improve the locality of
+//   graph traversals when the graph is relabeled with ReorderedGraph, where
+//   ord[i] is the original vertex that is given the label i
+// degreeOrder sorts the vertices by decreasing degree (breaking ties by
+//   index), which places the hubs of a skewed graph together
+// reverseCuthillMcKeeOrder is a breadth first search from a pseudo
+//   peripheral vertex of each component (found by repeatedly searching from
+//   a vertex of minimum degree in the last level), visiting the neighbours
+//   of each vertex in increasing order of degree, and then reversing the
+//   order, which reduces the bandwidth of the adjacency matrix
+// gorderOrder greedily appends the unplaced vertex with the largest score
+//   with the last W placed vertices, where the score of a pair is the number
+//   of edges between them plus the number of common neighbours (ignoring
+//   neighbours with a degree larger than HUB), starting from the vertex of
+//   maximum degree, and using a bucket queue since scores only change by 1
+// The graph should contain both directions of each edge for
+//   reverseCuthillMcKeeOrder and gorderOrder, otherwise only the outgoing
+//   edges are considered
+// Vertices are 0-indexed
+// Function Arguments:
+//   G: a StaticGraph or StaticWeightedGraph
+//   W: the size of the window for gorderOrder
+//   HUB: the maximum degree of a common neighbour for gorderOrder
+// Return Value: a vector ord of the vertices in the new order
+// In practice, degreeOrder and reverseCuthillMcKeeOrder have a small
+//   constant, and gorderOrder has a moderate constant
+// Time Complexity:
+//   degreeOrder: O(V log V)
+//   reverseCuthillMcKeeOrder: O(V log V + E log E) in addition to the
+//     searches for the pseudo peripheral vertices, which are usually a
+//     small constant number of breadth first searches per component
+//   gorderOrder: O(V + W sum(deg(v) min(deg(v), HUB)))
+// Memory Complexity: O(V)
+// Tested:
+//   Fuzz and Stress Tested
+template <class Graph> vector<int> degreeOrder(const Graph &G) {
+  int V = G.size(); vector<int> ord(V); iota(ord.begin(), ord.end(), 0);
+  stable_sort(ord.begin(), ord.end(), [&] (int v, int w) {
+    return G.ST[v + 1] - G.ST[v] > G.ST[w + 1] - G.ST[w];
+  });
+  return ord;
+}
+
+template <class Graph> vector<int> reverseCuthillMcKeeOrder(const Graph &G) {
+  int V = G.size(); vector<int> ord, P(V), lvl(V, -1), q; ord.reserve(V);
+  vector<bool> vis(V, false);
+  auto deg = [&] (int v) { return G.ST[v + 1] - G.ST[v]; };
+  auto cmp = [&] (int v, int w) {
+    return deg(v) == deg(w) ? v < w : deg(v) < deg(w);
+  };
+  iota(P.begin(), P.end(), 0); sort(P.begin(), P.end(), cmp);
+  auto levels = [&] (int s) {
+    for (int v : q) lvl[v] = -1;
+    q.clear(); q.push_back(s); lvl[s] = 0;
+    for (int front = 0; front < int(q.size()); front++) {
+      int v = q[front]; for (int e = G.ST[v]; e < G.ST[v + 1]; e++)
+        if (!vis[G.TO[e]] && lvl[G.TO[e]] == -1) {
+          lvl[G.TO[e]] = lvl[v] + 1; q.push_back(G.TO[e]);
+        }
+    }
+    return lvl[q.back()];
+  };
+  for (int p : P) while (!vis[p]) {
+    int s = p; for (int ecc = levels(s); ; ) {
+      int t = -1; for (int v : q)
+        if (lvl[v] == ecc && (t == -1 || cmp(v, t))) t = v;
+      int e = levels(s = t); if (e <= ecc) break;
+      ecc = e;
+    }
+    vis[s] = true; ord.push_back(s);
+    for (int front = int(ord.size()) - 1; front < int(ord.size()); front++) {
+      int v = ord[front], mid = ord.size();
+      for (int e = G.ST[v]; e < G.ST[v + 1]; e++)
+        if (!vis[G.TO[e]]) { vis[G.TO[e]] = true; ord.push_back(G.TO[e]); }
+      sort(ord.begin() + mid, ord.end(), cmp);
+    }
+  }
+  reverse(ord.begin(), ord.end()); return ord;
+}
+
+template <class Graph>
+vector<int> gorderOrder(const Graph &G, int W = 5, int HUB = 256) {
+  int V = G.size(), top = 0; vector<int> ord, key(V, 0), nxt(V), prv(V);
+  vector<int> head(1, -1); vector<bool> done(V, false); ord.reserve(V);
+  auto erase = [&] (int v) {
+    if (prv[v] == -1) head[key[v]] = nxt[v];
+    else nxt[prv[v]] = nxt[v];
+    if (nxt[v] != -1) prv[nxt[v]] = prv[v];
+  };
+  auto insert = [&] (int v) {
+    if (key[v] >= int(head.size())) head.resize(key[v] + 1, -1);
+    prv[v] = -1; nxt[v] = head[key[v]]; if (nxt[v] != -1) prv[nxt[v]] = v;
+    head[key[v]] = v; top = max(top, key[v]);
+  };
+  auto update = [&] (int v, int d) {
+    if (!done[v]) { erase(v); key[v] += d; insert(v); }
+  };
+  auto slide = [&] (int u, int d) {
+    for (int e = G.ST[u]; e < G.ST[u + 1]; e++) {
+      int w = G.TO[e]; update(w, d);
+      if (G.ST[w + 1] - G.ST[w] <= HUB)
+        for (int f = G.ST[w]; f < G.ST[w + 1]; f++)
+          if (G.TO[f] != u) update(G.TO[f], d);
+    }
+  };
+  vector<int> P = degreeOrder(G);
+  for (int i = V - 1; i >= 0; i--) insert(P[i]);
+  while (int(ord.size()) < V) {
+    while (head[top] == -1) top--;
+    int v = head[top]; erase(v); done[v] = true; ord.push_back(v);
+    slide(v, 1);
+    if (int(ord.size()) > W) slide(ord[ord.size() - W - 1], -1);
+  }
+  return ord;
+}
+
+// Relabels the vertices of a static graph so that the vertex ord[i] becomes
+//   vertex i, with the adjacency list of each vertex sorted by the new
+//   labels, so that graph algorithms can be run on the relabeled graph with
+//   better locality, and the results mapped back to the original vertices
+// Vertices are 0-indexed
+// Template Arguments:
+//   Graph: either StaticGraph or StaticWeightedGraph
+// Constructor Arguments:
+//   H: the original graph, which must already be built
+//   ord: a permutation of the vertices, where ord[i] is the original vertex
+//     with the new label i, such as the result of degreeOrder,
+//     reverseCuthillMcKeeOrder, or gorderOrder
+// Fields:
+//   G: the relabeled graph, which is already built
+//   ord: the original vertex of each new label
+//   ind: the new label of each original vertex
+// In practice, has a small constant
+// Time Complexity:
+//   constructor: O(V + E log E)
+// Memory Complexity: O(V + E)
+// Tested:
+//   Fuzz and Stress Tested
+template <class Graph> struct ReorderedGraph {
+  Graph G; vector<int> ord, ind;
+  ReorderedGraph(const Graph &H, const vector<int> &ord)
+      : G(H.size()), ord(ord), ind(H.size()) {
+    int V = H.size(), E = H.TO.size(); vector<int> src; src.reserve(E);
+    for (int i = 0; i < V; i++) ind[ord[i]] = i;
+    for (int i = 0; i < V; i++) {
+      int v = ord[i], mid = src.size(); G.ST[i + 1] = G.ST[i];
+      for (int e = H.ST[v]; e < H.ST[v + 1]; e++) {
+        src.push_back(e); G.ST[i + 1]++;
+      }
+      sort(src.begin() + mid, src.end(), [&] (int a, int b) {
+        return make_pair(ind[H.TO[a]], a) < make_pair(ind[H.TO[b]], b);
+      });
+    }
+    G.TO.resize(E); G.A.resize(E); G.B.resize(E);
+    for (int i = 0; i < V; i++) for (int e = G.ST[i]; e < G.ST[i + 1]; e++) {
+      G.A[e] = i; G.B[e] = G.TO[e] = ind[H.TO[src[e]]];
+    }
+    copyWeights(H, src, G);
+  }
+  static void copyWeights(const StaticGraph &, const vector<int> &,
+                          StaticGraph &) {}
+  template <class T>
+  static void copyWeights(const StaticWeightedGraph<T> &H,
+                          const vector<int> &src, StaticWeightedGraph<T> &G) {
+    G.WEIGHT.resize(src.size());
+    for (int e = 0; e < int(src.size()); e++) G.WEIGHT[e] = H.WEIGHT[src[e]];
+    G.C = G.WEIGHT;
+  }
+};
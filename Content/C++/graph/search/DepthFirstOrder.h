@@ -1,9 +1,11 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "DepthFirstStack.h"
 using namespace std;
 
 // Computes Depth First Orders of a graph (pre order, post order,
-//   topological/reverse post order)
+//   topological/reverse post order), with an explicit stack for the depth
+//   first search
 // Vertices are 0-indexed
 // Constructor Arguments:
 //   G: a generic graph structure
@@ -32,16 +34,23 @@ using namespace std;
 struct DFSOrder {
   int V, curPre, curPost, curRevPost;
   vector<int> preInd, postInd, revPostInd, preVert, postVert, revPostVert;
-  template <class Graph> void dfs(const Graph &G, int v) {
-    preVert[preInd[v] = curPre++] = v;
-    for (int w : G[v]) if (preInd[w] == -1) dfs(G, w);
-    postVert[postInd[v] = curPost++] = v;
-    revPostVert[revPostInd[v] = curRevPost--] = v;
+  template <class Graph> void enter(DFSStack<Graph> &S, int v) {
+    preVert[preInd[v] = curPre++] = v; S.push(v);
+  }
+  template <class Graph> void dfs(DFSStack<Graph> &S, int s) {
+    enter(S, s); while (!S.empty()) {
+      int v = S.top(), w; if (S.next(w)) {
+        if (preInd[w] == -1) enter(S, w);
+        continue;
+      }
+      S.pop(); postVert[postInd[v] = curPost++] = v;
+      revPostVert[revPostInd[v] = curRevPost--] = v;
+    }
   }
   template <class Graph> DFSOrder(const Graph &G, const vector<int> &roots)
       : V(G.size()), curPre(0), curPost(0), curRevPost(V - 1), preInd(V, -1),
         postInd(V), revPostInd(V), preVert(V), postVert(V), revPostVert(V) {
-    for (int v : roots) if (preInd[v] == -1) dfs(G, v);
+    DFSStack<Graph> S(G); for (int v : roots) if (preInd[v] == -1) dfs(S, v);
   }
   template <class Graph> DFSOrder(const Graph &G, int rt)
       : DFSOrder(G, vector<int>{rt}) {}
@@ -0,0 +1,82 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// Iterates over the adjacency list of a vertex in a generic graph structure
+//   using the iterators returned by operator []
+template <class Graph, class = void> struct DFSEdges {
+  using It = decltype(declval<const Graph &>()[0].begin());
+  struct Range { It it, en; };
+  static Range range(const Graph &G, int v) {
+    auto &&adj = G[v]; return Range{adj.begin(), adj.end()};
+  }
+  static bool next(const Graph &, Range &r, int &w) {
+    if (!(r.it != r.en)) return false;
+    w = *r.it; ++r.it; return true;
+  }
+};
+
+// Iterates over the adjacency list of a vertex in a graph structure with
+//   the compressed sparse row arrays ST and TO (such as StaticGraph)
+//   directly, instead of through the iterators returned by operator []
+template <class Graph> struct DFSEdges<Graph, decltype(
+    void(declval<const Graph &>().ST), void(declval<const Graph &>().TO))> {
+  struct Range { int it, en; };
+  static Range range(const Graph &G, int v) {
+    return Range{G.ST[v], G.ST[v + 1]};
+  }
+  static bool next(const Graph &G, Range &r, int &w) {
+    if (r.it == r.en) return false;
+    w = G.TO[r.it++]; return true;
+  }
+};
+
+// An explicit stack for an iterative depth first search of a graph, where
+//   each frame stores a vertex, the position of the next edge in its
+//   adjacency list, and an integer for the caller, so that any recursive
+//   depth first search can be done without being limited by the size of the
+//   call stack, visiting the vertices and edges in the same order
+// Graphs with the compressed sparse row arrays ST and TO (such as
+//   StaticGraph) are iterated over directly
+// Vertices are 0-indexed
+// Constructor Arguments:
+//   G: a generic graph structure
+//     Required Functions:
+//       operator [v] const: iterates over the adjacency list of vertex v
+//         (which is a list of ints)
+//       size() const: returns the number of vertices in the graph
+// Functions:
+//   push(v, x): pushes a frame for vertex v with the integer x, starting at
+//     the first edge of v
+//   pop(): pops the top frame
+//   empty(): returns whether the stack is empty
+//   size(): returns the number of frames on the stack
+//   top(): returns the vertex of the top frame
+//   parent(): returns the vertex of the frame below the top frame, or -1 if
+//     there is only one frame
+//   val(): returns a reference to the integer of the top frame
+//   next(w): returns false if every edge of the vertex of the top frame has
+//     been visited, otherwise sets w to the next adjacent vertex, moves to
+//     the following edge, and returns true
+// In practice, has a very small constant
+// Time Complexity:
+//   constructor, push, pop, empty, size, top, parent, val, next: O(1)
+// Memory Complexity: O(V)
+// Tested:
+//   Fuzz Tested
+template <class Graph> struct DFSStack {
+  using Edges = DFSEdges<Graph>;
+  struct Frame { int v, x; typename Edges::Range r; };
+  const Graph &G; vector<Frame> stk;
+  DFSStack(const Graph &G) : G(G) {}
+  void push(int v, int x = 0) {
+    stk.push_back(Frame{v, x, Edges::range(G, v)});
+  }
+  void pop() { stk.pop_back(); }
+  bool empty() const { return stk.empty(); }
+  int size() const { return stk.size(); }
+  int top() const { return stk.back().v; }
+  int parent() const { return stk.size() > 1 ? stk[stk.size() - 2].v : -1; }
+  int &val() { return stk.back().x; }
+  bool next(int &w) { return Edges::next(G, stk.back().r, w); }
+};
@@ -0,0 +1,111 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../components/StronglyConnectedComponents.h"
+using namespace std;
+
+// Answers reachability queries in a graph with randomized interval labels
+//   over the condensation of its strongly connected components (GRAIL)
+// Each of the K labels of a component is the interval from the minimum
+//   post order rank in its subtree to its own post order rank in a depth
+//   first traversal of the condensation with the roots and children in a
+//   random order, so if w is reachable from v, then every label of w is
+//   contained in the corresponding label of v
+// A query returns false as soon as a label is not contained, or if the
+//   level of v (the number of edges on the longest path from it in the
+//   condensation) is not more than the level of w, returns true if v is an
+//   ancestor of w in the depth first spanning forest of the first traversal,
+//   and otherwise falls back to a depth first search from v that only visits
+//   components whose labels and levels do not exclude w
+// Vertices are 0-indexed
+// Constructor Arguments:
+//   G: a generic graph structure
+//     Required Functions:
+//       operator [v] const: iterates over the adjacency list of vertex v
+//         (which is a list of ints)
+//       size() const: returns the number of vertices in the graph
+//   K: the number of interval labels for each component, where larger
+//     values make the fallback searches less frequent
+//   seed: the seed for the random traversal orders
+// Fields:
+//   DAG: the edges of the condensation, sorted by the first element
+//   scc: the strongly connected components of the graph
+// Functions:
+//   reachable(v, w): returns true if w is reachable from v and false otherwise
+// In practice, has a small constant, and the fallback search rarely visits
+//   more than a few components on sparse graphs
+// Time Complexity:
+//   constructor: O(V + E + K (C + D)) for C components and D edges in the
+//     condensation
+//   reachable: O(K) if the labels, levels, or spanning forest decide the
+//     query, O(K (C + D)) in the worst case
+// Memory Complexity: O(V + E + K C)
+// Tested:
+//   Fuzz Tested
+struct ReachabilityIndex {
+  vector<pair<int, int>> DAG; SCC scc; int C, K;
+  vector<int> st, to, lvl, pre, post, stk; vector<pair<int, int>> L;
+  vector<unsigned> vis; unsigned cur;
+  template <class Graph>
+  ReachabilityIndex(const Graph &G, int K = 5, uint64_t seed = 0)
+      : DAG(), scc(G, DAG), C(scc.components.size()), K(max(K, 1)),
+        st(C + 1, 0), to(DAG.size()), lvl(C, 0), pre(C), post(C),
+        L(size_t(C) * this->K), vis(C, 0), cur(0) {
+    for (int e = 0; e < int(DAG.size()); e++) {
+      st[DAG[e].first + 1]++; to[e] = DAG[e].second;
+    }
+    partial_sum(st.begin(), st.end(), st.begin());
+    for (int c = 0; c < C; c++) for (int e = st[c]; e < st[c + 1]; e++)
+      lvl[c] = max(lvl[c], lvl[to[e]] + 1);
+    mt19937_64 rng(seed); vector<int> ord(C), it(C);
+    iota(ord.begin(), ord.end(), 0); for (int i = 0; i < this->K; i++) {
+      shuffle(ord.begin(), ord.end(), rng); for (int c = 0; c < C; c++)
+        shuffle(to.begin() + st[c], to.begin() + st[c + 1], rng);
+      fill(it.begin(), it.end(), -1); int rank = 0, t = 0;
+      for (int r : ord) if (it[r] == -1) {
+        it[r] = st[r]; stk.push_back(r); if (i == 0) pre[r] = t++;
+        while (!stk.empty()) {
+          int v = stk.back(); if (it[v] < st[v + 1]) {
+            int u = to[it[v]++]; if (it[u] == -1) {
+              it[u] = st[u]; stk.push_back(u); if (i == 0) pre[u] = t++;
+            }
+            continue;
+          }
+          stk.pop_back(); int lo = rank;
+          for (int e = st[v]; e < st[v + 1]; e++)
+            lo = min(lo, L[size_t(to[e]) * this->K + i].first);
+          L[size_t(v) * this->K + i] = make_pair(lo, rank);
+          if (i == 0) post[v] = rank;
+          rank++;
+        }
+      }
+    }
+  }
+  bool contains(int a, int b) const {
+    const pair<int, int> *x = &L[size_t(a) * K], *y = &L[size_t(b) * K];
+    for (int i = 0; i < K; i++)
+      if (y[i].first < x[i].first || y[i].second > x[i].second) return false;
+    return true;
+  }
+  bool candidate(int a, int b) const {
+    return lvl[a] > lvl[b] && contains(a, b);
+  }
+  bool ancestor(int a, int b) const {
+    return pre[a] <= pre[b] && post[b] <= post[a];
+  }
+  bool reachable(int v, int w) {
+    int a = scc.id[v], b = scc.id[w]; if (a == b) return true;
+    if (!candidate(a, b)) return false;
+    if (ancestor(a, b)) return true;
+    if (++cur == 0) { fill(vis.begin(), vis.end(), 0); cur = 1; }
+    stk.clear(); stk.push_back(a); vis[a] = cur; while (!stk.empty()) {
+      int c = stk.back(); stk.pop_back();
+      for (int e = st[c]; e < st[c + 1]; e++) {
+        int u = to[e]; if (u == b) return true;
+        if (vis[u] == cur || !candidate(u, b)) continue;
+        if (ancestor(u, b)) return true;
+        vis[u] = cur; stk.push_back(u);
+      }
+    }
+    return false;
+  }
+};
@@ -1,6 +1,8 @@
 #pragma once
 #include <bits/stdc++.h>
 #include "../components/StronglyConnectedComponents.h"
+#include "../../datastructures/BitMatrix.h"
+#include "../../utils/ThreadPool.h"
 using namespace std;
 
 // Computes the Transitive Closure in a graph using strongly connected
@@ -73,3 +75,118 @@ template <const int MAXV> struct TransitiveClosureFloydWarshall {
   }
   bool reachable(int v, int w) { return dp[v][w]; }
 };
+
+// Computes the Transitive Closure in a graph using strongly connected
+//   components and dynamic programming over a runtime sized bit matrix
+// The components are grouped into levels, where the level of a component is
+//   the number of edges on the longest path from it in the condensation, so
+//   the row of each component only depends on the rows of components in
+//   lower levels, and each level is split into contiguous chunks that are
+//   processed in parallel
+// Since each row is computed by a single thread in the same order, the
+//   result does not depend on the policy
+// Vertices are 0-indexed
+// Template Arguments:
+//   Policy: the execution policy for each level, either SerialPolicy or
+//     ParallelPolicy
+// Constructor Arguments:
+//   G: a generic graph structure
+//     Required Functions:
+//       operator [v] const: iterates over the adjacency list of vertex v
+//         (which is a list of ints)
+//       size() const: returns the number of vertices in the graph
+// Fields:
+//   DAG: the edges of the condensation, sorted by the first element
+//   scc: the strongly connected components of the graph
+//   dp: a C x C bit matrix where dp[c][d] is 1 if component d is reachable
+//     from component c, for C components
+// Functions:
+//   reachable(v, w): returns true if w is reachable from v and false otherwise
+// In practice, has a very small constant, similar to TransitiveClosureSCC
+//   on a single thread, and scales with the number of threads if the levels
+//   are large
+// Time Complexity:
+//   constructor: O(V + E + C E / 64) for C components
+//   reachable: O(1)
+// Memory Complexity: O(V + E + C^2 / 64)
+// Tested:
+//   Fuzz and Stress Tested
+template <class Policy = SerialPolicy> struct LeveledTransitiveClosureSCC {
+  vector<pair<int, int>> DAG; SCC scc; BitMatrix dp;
+  template <class Graph> LeveledTransitiveClosureSCC(const Graph &G)
+      : DAG(), scc(G, DAG),
+        dp(scc.components.size(), scc.components.size()) {
+    int C = dp.N; vector<int> st(C + 1, 0), lvl(C, 0), ind(C + 1, 0), ord(C);
+    for (auto &&e : DAG) st[e.first + 1]++;
+    partial_sum(st.begin(), st.end(), st.begin());
+    for (int c = 0; c < C; c++) {
+      for (int e = st[c]; e < st[c + 1]; e++)
+        lvl[c] = max(lvl[c], lvl[DAG[e].second] + 1);
+      ind[lvl[c] + 1]++;
+    }
+    partial_sum(ind.begin(), ind.end(), ind.begin());
+    vector<int> pos = ind; for (int c = 0; c < C; c++) ord[pos[lvl[c]]++] = c;
+    int grain = max(1, (1 << 14) / max(1, dp.W));
+    for (int l = 0; l < C && ind[l] < C; l++) {
+      Policy::forRange(ind[l], ind[l + 1], [&] (int lo, int hi) {
+        for (int i = lo; i < hi; i++) {
+          int c = ord[i]; dp.set(c, c);
+          for (int e = st[c]; e < st[c + 1]; e++) dp.orRow(c, DAG[e].second);
+        }
+      }, grain);
+    }
+  }
+  bool reachable(int v, int w) const {
+    return dp.get(scc.id[v], scc.id[w]);
+  }
+};
+
+// Computes the Transitive Closure in a graph using Floyd Warshall over a
+//   runtime sized bit matrix, with the pivots split into blocks small enough
+//   for their rows to stay in cache
+// For each block of pivots, the rows of the pivots are first updated with
+//   the pivots in the block in order, and then every other row is updated
+//   with the final rows of the pivots in the block, which are supersets of
+//   the rows used by the unblocked algorithm and only contain reachable
+//   vertices, with the other rows split into contiguous chunks that are
+//   processed in parallel
+// Since each row is computed by a single thread in the same order, the
+//   result does not depend on the policy
+// Vertices are 0-indexed
+// Template Arguments:
+//   Policy: the execution policy for the rows outside each block, either
+//     SerialPolicy or ParallelPolicy
+// Constructor Arguments:
+//   matrix: a V x V bit matrix such that matrix[v][w] is 1 if there is a
+//     directed edge from v to w and 0 otherwise
+// Fields:
+//   dp: a V x V bit matrix where dp[v][w] is 1 if w is reachable from v
+// Functions:
+//   reachable(v, w): returns true if w is reachable from v and false otherwise
+// In practice, has a very small constant, slower than the SCC variants
+// Time Complexity:
+//   constructor: O(V^3 / 64)
+//   reachable: O(1)
+// Memory Complexity: O(V^2 / 64)
+// Tested:
+//   Fuzz and Stress Tested
+template <class Policy = SerialPolicy>
+struct BlockedTransitiveClosureFloydWarshall {
+  BitMatrix dp;
+  BlockedTransitiveClosureFloydWarshall(const BitMatrix &matrix)
+      : dp(matrix) {
+    int V = dp.N; for (int v = 0; v < V; v++) dp.set(v, v);
+    int B = max(1, min(V, (1 << 15) / max(1, dp.W)));
+    int grain = max(1, (1 << 14) / max(1, B * dp.W));
+    for (int k0 = 0; k0 < V; k0 += B) {
+      int k1 = min(V, k0 + B);
+      for (int k = k0; k < k1; k++) for (int v = k0; v < k1; v++)
+        if (v != k && dp.get(v, k)) dp.orRow(v, k);
+      Policy::forRange(0, V, [&] (int lo, int hi) {
+        for (int v = lo; v < hi; v++) if (v < k0 || v >= k1)
+          for (int k = k0; k < k1; k++) if (dp.get(v, k)) dp.orRow(v, k);
+      }, grain);
+    }
+  }
+  bool reachable(int v, int w) const { return dp.get(v, w); }
+};
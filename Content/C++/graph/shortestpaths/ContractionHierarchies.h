@@ -0,0 +1,209 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../representations/StaticGraph.h"
+#include "SSSPQueries.h"
+using namespace std;
+
+// Contraction hierarchies to answer point to point shortest path queries
+//   on a static directed weighted graph without negative weights
+// The vertices are contracted one at a time in order of a lazily updated
+//   priority (the number of shortcuts added minus the number of edges
+//   removed, plus the level of the vertex, which is one more than the
+//   maximum level of its contracted neighbours), where contracting vertex v
+//   adds a shortcut u -> w for each pair of edges u -> v -> w unless a local
+//   Dijkstra search from u that avoids v and settles at most witnessLimit
+//   vertices finds a path from u to w that is not longer
+// Each query runs a bidirectional Dijkstra search that only moves to
+//   vertices later in the contraction order, with stall on demand, and
+//   shortcuts are unpacked into the original edges by recursively
+//   replacing each shortcut with the two edges it was made from
+// Vertices are 0-indexed
+// Template Arguments:
+//   T: the type of the weight of the edges in the graph
+// Constructor Arguments:
+//   G: a generic weighted graph structure
+//     Required Functions:
+//       operator [v] const: iterates over the adjacency list of vertex v
+//         (which is a list of pair<int, T> with weights of type T)
+//       size() const: returns the number of vertices in the graph
+//   witnessLimit: the maximum number of vertices settled by each witness
+//     search, where larger values give fewer shortcuts but a slower
+//     preprocessing
+//   INF: a value for infinity
+// Fields:
+//   V: the number of vertices in the graph
+//   rnk: the position of each vertex in the contraction order
+//   up: the edges (including shortcuts) u -> w where rnk[u] < rnk[w]
+//   down: the edges (including shortcuts) u -> w where rnk[u] > rnk[w],
+//     stored in reverse as w -> u
+//   upMid, downMid: the vertex that each edge of up and down skips, in the
+//     same order as up.TO and down.TO, or -1 if it is an original edge
+// Functions:
+//   dist(s, t): returns the shortest distance from vertex s to vertex t, or
+//     INF if unreachable
+//   getPath(s, t): returns the list of directed edges of the original graph
+//     on a shortest path from vertex s to vertex t
+// In practice, the constructor has a large constant, while dist and getPath
+//   have a very small constant on road networks and similar graphs
+// Time Complexity:
+//   constructor: O(V (D^2 L log L) + E) for a maximum degree of D during the
+//     contraction and a witness limit of L
+//   dist: O(S log S) where S is the size of the search spaces, which is
+//     usually much smaller than V
+//   getPath: O(S log S + K D) for a path with K edges
+// Memory Complexity: O(V + E + C) for C shortcuts
+// Tested:
+//   Fuzz Tested
+template <class T> struct ContractionHierarchies {
+  using Edge = tuple<int, int, T>; struct Arc { int to; T w; int mid; };
+  int V; T INF; vector<int> rnk, upMid, downMid;
+  StaticWeightedGraph<T> up, down; SSSPWorkspace<T> F, B;
+  vector<pair<T, int>> PQF, PQB; int meet;
+  template <class WeightedGraph>
+  ContractionHierarchies(const WeightedGraph &G, int witnessLimit = 500,
+                         T INF = numeric_limits<T>::max())
+      : V(G.size()), INF(INF), rnk(V, -1), up(V), down(V), F(V, INF),
+        B(V, INF), meet(-1) {
+    vector<vector<Arc>> out(V), in(V); vector<int> lvl(V, 0), prio(V);
+    auto addArc = [&] (int u, int x, T w, int mid) {
+      for (auto &&a : out[u]) if (a.to == x) {
+        if (w < a.w) {
+          a.w = w; a.mid = mid;
+          for (auto &&b : in[x]) if (b.to == u) { b.w = w; b.mid = mid; }
+        }
+        return;
+      }
+      out[u].push_back(Arc{x, w, mid}); in[x].push_back(Arc{u, w, mid});
+    };
+    for (int v = 0; v < V; v++) for (auto &&e : G[v])
+      if (e.first != v) addArc(v, e.first, e.second, -1);
+    SSSPWorkspace<T> W(V, INF); vector<pair<T, int>> H;
+    greater<pair<T, int>> cmp;
+    vector<int> tgt; auto witness = [&] (int s, int skip, T limit) {
+      W.start(tgt); W.set(s, T(), -1); H.clear();
+      H.emplace_back(T(), s); for (int cnt = 0; !H.empty();) {
+        pop_heap(H.begin(), H.end(), cmp);
+        T d = H.back().first; int v = H.back().second; H.pop_back();
+        if (d > W.dist(v)) continue;
+        if (d > limit || cnt++ >= witnessLimit || W.settle(v)) break;
+        for (auto &&a : out[v]) if (a.to != skip) {
+          T nd = d + a.w; if (nd < W.dist(a.to)) {
+            W.set(a.to, nd, v); H.emplace_back(nd, a.to);
+            push_heap(H.begin(), H.end(), cmp);
+          }
+        }
+      }
+    };
+    auto contract = [&] (int v, bool apply) {
+      int cnt = 0; for (auto &&a : in[v]) {
+        int u = a.to; T limit = T(); tgt.clear();
+        for (auto &&b : out[v]) if (b.to != u) {
+          limit = max(limit, a.w + b.w); tgt.push_back(b.to);
+        }
+        if (tgt.empty()) continue;
+        witness(u, v, limit);
+        for (auto &&b : out[v]) if (b.to != u && W.dist(b.to) > a.w + b.w) {
+          cnt++; if (apply) addArc(u, b.to, a.w + b.w, v);
+        }
+      }
+      return cnt;
+    };
+    auto priority = [&] (int v) {
+      return contract(v, false) - int(in[v].size() + out[v].size()) + lvl[v];
+    };
+    std::priority_queue<pair<int, int>, vector<pair<int, int>>,
+                        greater<pair<int, int>>> PQ;
+    for (int v = 0; v < V; v++) PQ.emplace(prio[v] = priority(v), v);
+    vector<tuple<int, int, T, int>> U, D;
+    for (int order = 0; !PQ.empty();) {
+      int p = PQ.top().first, v = PQ.top().second; PQ.pop();
+      if (rnk[v] != -1 || p != prio[v]) continue;
+      if (!PQ.empty() && (prio[v] = priority(v)) > PQ.top().first) {
+        PQ.emplace(prio[v], v); continue;
+      }
+      contract(v, true); rnk[v] = order++;
+      for (auto &&a : out[v]) {
+        U.emplace_back(v, a.to, a.w, a.mid);
+        auto &L = in[a.to]; for (int i = 0; i < int(L.size()); i++)
+          if (L[i].to == v) { L[i] = L.back(); L.pop_back(); break; }
+      }
+      for (auto &&a : in[v]) {
+        D.emplace_back(v, a.to, a.w, a.mid);
+        auto &L = out[a.to]; for (int i = 0; i < int(L.size()); i++)
+          if (L[i].to == v) { L[i] = L.back(); L.pop_back(); break; }
+      }
+      vector<Arc> adj; adj.swap(out[v]);
+      adj.insert(adj.end(), in[v].begin(), in[v].end());
+      vector<Arc>().swap(in[v]);
+      for (auto &&a : adj) if (lvl[a.to] <= lvl[v]) {
+        prio[a.to] += lvl[v] + 1 - lvl[a.to]; lvl[a.to] = lvl[v] + 1;
+        PQ.emplace(prio[a.to], a.to);
+      }
+    }
+    upMid = build(up, U); downMid = build(down, D);
+  }
+  static vector<int> build(StaticWeightedGraph<T> &H,
+                           const vector<tuple<int, int, T, int>> &edges) {
+    StaticWeightedGraph<int> M(H.size());
+    H.reserveDiEdges(edges.size()); M.reserveDiEdges(edges.size());
+    for (auto &&e : edges) {
+      H.addDiEdge(get<0>(e), get<1>(e), get<2>(e));
+      M.addDiEdge(get<0>(e), get<1>(e), get<3>(e));
+    }
+    H.build(); M.build(); return M.WEIGHT;
+  }
+  T dist(int s, int t) {
+    greater<pair<T, int>> cmp; T best = INF; meet = -1;
+    F.start(vector<int>()); B.start(vector<int>()); PQF.clear(); PQB.clear();
+    F.set(s, T(), -1); PQF.emplace_back(T(), s);
+    B.set(t, T(), -1); PQB.emplace_back(T(), t);
+    while (!PQF.empty() || !PQB.empty()) {
+      bool fwd = PQB.empty()
+          || (!PQF.empty() && PQF[0].first <= PQB[0].first);
+      SSSPWorkspace<T> &X = fwd ? F : B, &Y = fwd ? B : F;
+      vector<pair<T, int>> &PQ = fwd ? PQF : PQB;
+      const StaticWeightedGraph<T> &G = fwd ? up : down, &R = fwd ? down : up;
+      if (!(PQ[0].first < best)) { PQ.clear(); continue; }
+      pop_heap(PQ.begin(), PQ.end(), cmp);
+      T d = PQ.back().first; int v = PQ.back().second; PQ.pop_back();
+      if (d > X.dist(v)) continue;
+      if (Y.dist(v) != INF && d + Y.dist(v) < best) {
+        best = d + Y.dist(v); meet = v;
+      }
+      bool stalled = false;
+      for (int i = R.ST[v]; i < R.ST[v + 1] && !stalled; i++)
+        if (X.dist(R.TO[i]) != INF && X.dist(R.TO[i]) + R.WEIGHT[i] < d)
+          stalled = true;
+      if (stalled) continue;
+      for (int i = G.ST[v]; i < G.ST[v + 1]; i++) {
+        int w = G.TO[i]; T nd = d + G.WEIGHT[i]; if (nd < X.dist(w)) {
+          X.set(w, nd, v); PQ.emplace_back(nd, w);
+          push_heap(PQ.begin(), PQ.end(), cmp);
+        }
+      }
+    }
+    return best;
+  }
+  void unpack(int u, int x, vector<Edge> &path) const {
+    vector<pair<int, int>> stk{make_pair(u, x)}; while (!stk.empty()) {
+      u = stk.back().first; x = stk.back().second; stk.pop_back();
+      bool isUp = rnk[u] < rnk[x]; const StaticWeightedGraph<T> &G
+          = isUp ? up : down;
+      int a = isUp ? u : x, b = isUp ? x : u, i = G.ST[a];
+      while (G.TO[i] != b) i++;
+      int mid = isUp ? upMid[i] : downMid[i];
+      if (mid == -1) path.emplace_back(u, x, G.WEIGHT[i]);
+      else { stk.emplace_back(mid, x); stk.emplace_back(u, mid); }
+    }
+  }
+  vector<Edge> getPath(int s, int t) {
+    vector<Edge> path; if (dist(s, t) == INF) return path;
+    vector<int> fwd; for (int v = meet; v != -1; v = F.par(v))
+      fwd.push_back(v);
+    reverse(fwd.begin(), fwd.end());
+    for (int i = 0; i + 1 < int(fwd.size()); i++)
+      unpack(fwd[i], fwd[i + 1], path);
+    for (int v = meet; B.par(v) != -1; v = B.par(v)) unpack(v, B.par(v), path);
+    return path;
+  }
+};
@@ -0,0 +1,166 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../../utils/ThreadPool.h"
+using namespace std;
+
+// Delta stepping single source shortest path algorithm for weighted graphs
+//   without negative weights
+// Vertices are kept in buckets of width delta by their tentative distance,
+//   and the smallest nonempty bucket is settled by repeatedly relaxing the
+//   light edges (with weight at most delta) of the vertices in it until it
+//   is empty, and then relaxing the heavy edges of every vertex removed
+//   from it
+// Each relaxation round is split into two phases, with the frontier split
+//   into contiguous chunks that generate relaxation requests in parallel,
+//   followed by each owner of a contiguous block of vertices applying the
+//   requests for its block in parallel, so no synchronization is needed
+//   other than the barrier between the phases
+// Each owner keeps its buckets in a ring of NB = min(W / delta, V / P) + 2
+//   buckets for a maximum weight of W and P threads, and vertices whose
+//   bucket is past the end of the ring are kept in an overflow list, which
+//   is rescanned each time the ring wraps around to move the vertices that
+//   now fit into the ring, and if the ring is empty, the scan jumps directly
+//   to the smallest bucket in the overflow list
+// Vertices are 0-indexed
+// Template Arguments:
+//   T: the type of the weight of the edges in the graph
+//   Policy: the execution policy for relaxing the edges, either
+//     SerialPolicy or ParallelPolicy
+// Constructor Arguments:
+//   G: a generic weighted graph structure
+//     Required Functions:
+//       operator [v] const: iterates over the adjacency list of vertex v
+//         (which is a list of pair<int, T> with weights of type T)
+//       size() const: returns the number of vertices in the graph
+//   s: a single source vertex
+//   src: a vector of source vertices
+//   INF: a value for infinity
+//   delta: the width of each bucket, or a non positive value to use the
+//     maximum weight divided by the average degree
+// Fields:
+//   dist: vector of shortest distance from the closest source vertex to each
+//     vertex, or INF if unreachable
+//   par: the parent vertex for each vertex in the shortest path tree, or
+//     -1 if there is no parent, which may differ from DijkstraSSSP if there
+//     are multiple shortest paths
+// Functions:
+//   getPath(v): returns the list of directed edges on the path from the
+//     closest source vertex to vertex v
+// In practice, the constructor has a small constant, similar to
+//   DijkstraSSSP on a single thread, and scales with the number of threads
+// Time Complexity:
+//   constructor: O(V + E + L / delta) for a maximum shortest path distance
+//     of L on graphs where few vertices are relaxed more than once, with
+//     the relaxations split across P threads, O(V E) in the worst case,
+//     plus a rescan of the overflow list every NB buckets, which only
+//     happens if delta is less than W / (V / P)
+//   getPath: O(V)
+// Memory Complexity: O(V + E + P^2)
+// Tested:
+//   Fuzz and Stress Tested
+template <class T, class Policy = SerialPolicy> struct DeltaSteppingSSSP {
+  using Edge = tuple<int, int, T>; vector<T> dist; vector<int> par; T INF;
+  struct Request { int to, from; T d; };
+  template <class WeightedGraph>
+  DeltaSteppingSSSP(const WeightedGraph &G, const vector<int> &srcs,
+                    T INF = numeric_limits<T>::max(), T delta = T())
+      : dist(G.size(), INF), par(G.size(), -1), INF(INF) {
+    int V = G.size(), P = max(1, Policy::threads()), SZ = (V + P - 1) / P;
+    long long E = 0; T maxW = T(); for (int v = 0; v < V; v++)
+      for (auto &&e : G[v]) { E++; maxW = max(maxW, e.second); }
+    if (!(delta > T())) delta = maxW / T(max(E / max(V, 1), 1LL));
+    if (!(delta > T())) delta = T(1);
+    auto bucket = [&] (T d) { return (long long)(d / delta); };
+    T R = maxW / delta; int NB = R >= T(V / P) ? V / P + 2 : int(R) + 2;
+    vector<vector<vector<int>>> B(P, vector<vector<int>>(NB));
+    vector<vector<vector<Request>>> req(P, vector<vector<Request>>(P));
+    vector<vector<int>> OV(P);
+    vector<long long> seen(V, -1), settled(V, -1), added(P, 0), moved(P, 0);
+    vector<int> F, S, keep; long long pending = 0, over = 0, cur = 0;
+    long long refill = NB;
+    auto relax = [&] (const vector<int> &frontier, bool light) {
+      int C = int(frontier.size()) >= (1 << 12) ? P : 1;
+      Policy::forRange(0, C, [&] (int lo, int hi) {
+        for (int c = lo; c < hi; c++) {
+          int st = int((long long)frontier.size() * c / C);
+          int en = int((long long)frontier.size() * (c + 1) / C);
+          for (int i = st; i < en; i++) {
+            int v = frontier[i]; for (auto &&e : G[v]) {
+              if ((e.second <= delta) != light) continue;
+              T d = dist[v] + e.second; if (d < dist[e.first])
+                req[c][e.first / SZ].push_back(Request{e.first, v, d});
+            }
+          }
+        }
+      });
+      long long total = 0;
+      for (int c = 0; c < C; c++) for (auto &&r : req[c]) total += r.size();
+      Policy::forRange(0, P, [&] (int lo, int hi) {
+        for (int o = lo; o < hi; o++) for (int c = 0; c < C; c++) {
+          for (auto &&r : req[c][o]) if (r.d < dist[r.to]) {
+            dist[r.to] = r.d; par[r.to] = r.from; long long k = bucket(r.d);
+            if (k < cur + NB) { B[o][k % NB].push_back(r.to); added[o]++; }
+            else { OV[o].push_back(r.to); moved[o]++; }
+          }
+          req[c][o].clear();
+        }
+      }, total >= (1 << 12) ? 1 : P);
+      for (int o = 0; o < P; o++) {
+        pending += added[o]; over += moved[o]; added[o] = moved[o] = 0;
+      }
+    };
+    auto fill = [&] {
+      Policy::forRange(0, P, [&] (int lo, int hi) {
+        for (int o = lo; o < hi; o++) {
+          int j = 0; for (int v : OV[o]) {
+            long long k = bucket(dist[v]); if (k < cur) moved[o]++;
+            else if (k < cur + NB) { B[o][k % NB].push_back(v); added[o]++; }
+            else OV[o][j++] = v;
+          }
+          OV[o].resize(j);
+        }
+      }, over >= (1 << 12) ? 1 : P);
+      for (int o = 0; o < P; o++) {
+        pending += added[o]; over -= added[o] + moved[o];
+        added[o] = moved[o] = 0;
+      }
+      refill = cur + NB;
+    };
+    for (int s : srcs) {
+      dist[s] = T(); par[s] = -1; B[s / SZ][0].push_back(s); pending++;
+    }
+    for (; pending + over > 0; cur++) {
+      if (pending == 0) {
+        long long m = LLONG_MAX; for (auto &&ov : OV)
+          for (int v : ov) m = min(m, bucket(dist[v]));
+        cur = max(cur, m); fill();
+      } else if (cur == refill) fill();
+      int b = int(cur % NB); S.clear();
+      while (true) {
+        F.clear(); for (int o = 0; o < P; o++) {
+          keep.clear(); pending -= B[o][b].size(); for (int v : B[o][b]) {
+            long long k = bucket(dist[v]);
+            if (k > cur) keep.push_back(v);
+            else if (k == cur && seen[v] != cur) {
+              seen[v] = cur; F.push_back(v);
+              if (settled[v] != cur) { settled[v] = cur; S.push_back(v); }
+            }
+          }
+          B[o][b].swap(keep); pending += B[o][b].size();
+        }
+        if (F.empty()) break;
+        relax(F, true); for (int v : F) seen[v] = -1;
+      }
+      if (!S.empty()) relax(S, false);
+    }
+  }
+  template <class WeightedGraph>
+  DeltaSteppingSSSP(const WeightedGraph &G, int s,
+                    T INF = numeric_limits<T>::max(), T delta = T())
+      : DeltaSteppingSSSP(G, vector<int>{s}, INF, delta) {}
+  vector<Edge> getPath(int v) {
+    vector<Edge> path; for (; par[v] != -1; v = par[v])
+      path.emplace_back(par[v], v, dist[v] - dist[par[v]]);
+    reverse(path.begin(), path.end()); return path;
+  }
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../../datastructures/trees/heaps/RadixPriorityQueue.h"
 using namespace std;
 
 // Dijkstra's single source shortest path algorithm for weighted graphs
@@ -7,6 +8,10 @@ using namespace std;
 // Vertices are 0-indexed
 // Template Arguments:
 //   T: the type of the weight of the edges in the graph
+//   RADIX: whether a radix priority queue is used instead of a binary heap,
+//     which requires T to be an integral type, and is faster for large
+//     graphs since each key is moved between buckets at most O(log W) times
+//     for a maximum distance W
 // Constructor Arguments:
 //   G: a generic weighted graph structure
 //     Required Functions:
@@ -26,7 +31,8 @@ using namespace std;
 //     closest source vertex to vertex v
 // In practice, the constructor has a small constant
 // Time Complexity:
-//   constructor: O((V + E) log E)
+//   constructor: O((V + E) log E) with a binary heap, O(V log W + E) with a
+//     radix priority queue
 //   getPath: O(V)
 // Memory Complexity: O(V)
 // Tested:
@@ -34,12 +40,16 @@ using namespace std;
 //   https://judge.yosupo.jp/problem/shortest_path
 //   https://open.kattis.com/problems/shortestpath1
 //   https://dmoj.ca/problem/sssp
-template <class T> struct DijkstraSSSP {
+template <class T, const bool RADIX = false> struct DijkstraSSSP {
   using Edge = tuple<int, int, T>; vector<T> dist; vector<int> par; T INF;
   template <class WeightedGraph>
   DijkstraSSSP(const WeightedGraph &G, const vector<int> &srcs,
                T INF = numeric_limits<T>::max())
       : dist(G.size(), INF), par(G.size(), -1), INF(INF) {
+    run(G, srcs, integral_constant<bool, RADIX>());
+  }
+  template <class WeightedGraph>
+  void run(const WeightedGraph &G, const vector<int> &srcs, false_type) {
     std::priority_queue<pair<T, int>, vector<pair<T, int>>,
                         greater<pair<T, int>>> PQ;
     for (int s : srcs) PQ.emplace(dist[s] = T(), s);
@@ -50,6 +60,19 @@ template <class T> struct DijkstraSSSP {
         PQ.emplace(dist[e.first] = dist[par[e.first] = v] + e.second, e.first);
     }
   }
+  template <class WeightedGraph>
+  void run(const WeightedGraph &G, const vector<int> &srcs, true_type) {
+    using Key = typename make_unsigned<T>::type;
+    RadixPriorityQueue<Key, int, greater<Key>> PQ;
+    for (int s : srcs) PQ.push(Key(dist[s] = T()), s);
+    while (!PQ.empty()) {
+      pair<Key, int> p = PQ.pop(); int v = p.second;
+      if (T(p.first) > dist[v]) continue;
+      for (auto &&e : G[v]) if (dist[e.first] > dist[v] + e.second)
+        PQ.push(Key(dist[e.first] = dist[par[e.first] = v] + e.second),
+                e.first);
+    }
+  }
   template <class WeightedGraph> DijkstraSSSP(const WeightedGraph &G, int s,
                                               T INF = numeric_limits<T>::max())
       : DijkstraSSSP(G, vector<int>{s}, INF) {}
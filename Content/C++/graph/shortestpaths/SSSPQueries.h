@@ -0,0 +1,236 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "../../utils/ThreadPool.h"
+using namespace std;
+
+// Reusable workspace for repeated single source shortest path queries on
+//   graphs with the same number of vertices, where the distances, parents,
+//   and visited flags of each vertex are only valid if its timestamp
+//   matches the timestamp of the current query, so starting a new query
+//   takes constant time instead of reallocating and clearing every vector
+// Vertices are 0-indexed
+// Template Arguments:
+//   T: the type of the weight of the edges in the graph
+// Constructor Arguments:
+//   V: the number of vertices in the graph
+//   INF: a value for infinity
+// Functions:
+//   dist(v): returns the shortest distance from the closest source vertex
+//     to vertex v in the last query, or INF if unreachable
+//   par(v): returns the parent vertex of vertex v in the shortest path tree
+//     of the last query, or -1 if there is no parent
+//   getPath(v): returns the list of directed edges on the path from the
+//     closest source vertex to vertex v in the last query
+// In practice, has a very small constant
+// Time Complexity:
+//   constructor: O(V)
+//   dist, par: O(1)
+//   getPath: O(V)
+// Memory Complexity: O(V)
+// Tested:
+//   Fuzz Tested
+template <class T> struct SSSPWorkspace {
+  using Weight = T; using Edge = tuple<int, int, T>;
+  vector<T> D; vector<int> P; vector<unsigned> stamp, done, target;
+  unsigned cur; int remaining; T INF;
+  SSSPWorkspace(int V, T INF)
+      : D(V), P(V), stamp(V, 0), done(V, 0), target(V, 0), cur(0),
+        remaining(0), INF(INF) {}
+  void start(const vector<int> &targets) {
+    if (++cur == 0) {
+      fill(stamp.begin(), stamp.end(), 0); fill(done.begin(), done.end(), 0);
+      fill(target.begin(), target.end(), 0); cur = 1;
+    }
+    remaining = targets.empty() ? -1 : 0;
+    for (int t : targets) if (target[t] != cur) {
+      target[t] = cur; remaining++;
+    }
+  }
+  void set(int v, T d, int p) { stamp[v] = cur; D[v] = d; P[v] = p; }
+  bool settle(int v) {
+    done[v] = cur; return target[v] == cur && --remaining == 0;
+  }
+  T dist(int v) const { return stamp[v] == cur ? D[v] : INF; }
+  int par(int v) const { return stamp[v] == cur ? P[v] : -1; }
+  vector<Edge> getPath(int v) const {
+    vector<Edge> path; for (; par(v) != -1; v = par(v))
+      path.emplace_back(par(v), v, dist(v) - dist(par(v)));
+    reverse(path.begin(), path.end()); return path;
+  }
+};
+
+// Reusable Dijkstra's single source shortest path queries for weighted
+//   graphs without negative weights, reusing the heap and the workspace
+//   between queries, and stopping early once every target is settled
+// Vertices are 0-indexed
+// Template Arguments:
+//   T: the type of the weight of the edges in the graph
+// Constructor Arguments:
+//   V: the number of vertices in the graph
+//   INF: a value for infinity
+// Functions:
+//   run(G, srcs, targets): computes the shortest distances from the source
+//     vertices in srcs, where G is a generic weighted graph structure with
+//     the same requirements as in DijkstraSSSP, and the search stops once
+//     every vertex in targets is settled if targets is not empty, in which
+//     case only the distances to the targets and the vertices on their
+//     paths are guaranteed to be correct
+//   dist, par, getPath: same as in SSSPWorkspace
+// In practice, has a small constant
+// Time Complexity:
+//   constructor: O(V)
+//   run: O((V + E) log E) for the visited vertices and edges
+// Memory Complexity: O(V + E)
+// Tested:
+//   Fuzz Tested
+template <class T> struct DijkstraQuery : public SSSPWorkspace<T> {
+  vector<pair<T, int>> PQ;
+  DijkstraQuery(int V, T INF = numeric_limits<T>::max())
+      : SSSPWorkspace<T>(V, INF) {}
+  template <class WeightedGraph>
+  void run(const WeightedGraph &G, const vector<int> &srcs,
+           const vector<int> &targets = vector<int>()) {
+    greater<pair<T, int>> cmp; PQ.clear(); this->start(targets);
+    for (int s : srcs) { this->set(s, T(), -1); PQ.emplace_back(T(), s); }
+    while (!PQ.empty()) {
+      pop_heap(PQ.begin(), PQ.end(), cmp);
+      T d = PQ.back().first; int v = PQ.back().second; PQ.pop_back();
+      if (this->done[v] == this->cur || d > this->dist(v)) continue;
+      if (this->settle(v)) break;
+      for (auto &&e : G[v]) {
+        T nd = d + e.second; if (this->dist(e.first) > nd) {
+          this->set(e.first, nd, v); PQ.emplace_back(nd, e.first);
+          push_heap(PQ.begin(), PQ.end(), cmp);
+        }
+      }
+    }
+  }
+};
+
+// Reusable breadth first traversal queries of a graph (weighted or
+//   unweighted), reusing the queue and the workspace between queries, and
+//   stopping early once every target is visited
+// Vertices are 0-indexed
+// Template Arguments:
+//   T: the type of the weight of the edges in the graph
+// Constructor Arguments:
+//   V: the number of vertices in the graph
+//   INF: a value for infinity
+// Functions:
+//   run(G, srcs, targets): computes the breadth first search tree from the
+//     source vertices in srcs, where G is a generic graph structure with the
+//     same requirements as in BFS, and the search stops once every vertex in
+//     targets is dequeued if targets is not empty
+//   dist, par, getPath: same as in SSSPWorkspace
+// In practice, has a small constant
+// Time Complexity:
+//   constructor: O(V)
+//   run: O(V + E) for the visited vertices and edges
+// Memory Complexity: O(V)
+// Tested:
+//   Fuzz Tested
+template <class T = int> struct BFSQuery : public SSSPWorkspace<T> {
+  vector<int> q;
+  BFSQuery(int V, T INF = numeric_limits<T>::max())
+      : SSSPWorkspace<T>(V, INF), q(V) {}
+  int getTo(int e) { return e; }
+  T getWeight(int) { return 1; }
+  int getTo(const pair<int, T> &e) { return e.first; }
+  T getWeight(const pair<int, T> &e) { return e.second; }
+  template <class Graph>
+  void run(const Graph &G, const vector<int> &srcs,
+           const vector<int> &targets = vector<int>()) {
+    int front = 0, back = 0; this->start(targets);
+    for (int s : srcs) if (this->stamp[s] != this->cur) {
+      this->set(q[back++] = s, T(), -1);
+    }
+    while (front < back) {
+      int v = q[front++]; if (this->settle(v)) break;
+      for (auto &&e : G[v]) {
+        int w = getTo(e); if (this->stamp[w] != this->cur)
+          this->set(q[back++] = w, this->D[v] + getWeight(e), v);
+      }
+    }
+  }
+};
+
+// Reusable breadth first traversal queries of a graph where all edge
+//   weights are 0 or 1, reusing the deque and the workspace between
+//   queries, and stopping early once every target is settled
+// Vertices are 0-indexed
+// Constructor Arguments:
+//   V: the number of vertices in the graph
+//   INF: a value for infinity
+// Functions:
+//   run(G, srcs, targets): computes the shortest distances from the source
+//     vertices in srcs, where G is a generic weighted graph structure with
+//     the same requirements as in ZeroOneBFS, and the search stops once
+//     every vertex in targets is settled if targets is not empty
+//   dist, par, getPath: same as in SSSPWorkspace
+// In practice, has a small constant
+// Time Complexity:
+//   constructor: O(V)
+//   run: O(V + E) for the visited vertices and edges
+// Memory Complexity: O(V + E)
+// Tested:
+//   Fuzz Tested
+struct ZeroOneBFSQuery : public SSSPWorkspace<int> {
+  deque<int> dq;
+  ZeroOneBFSQuery(int V, int INF = INT_MAX) : SSSPWorkspace<int>(V, INF) {}
+  template <class WeightedGraph>
+  void run(const WeightedGraph &G, const vector<int> &srcs,
+           const vector<int> &targets = vector<int>()) {
+    dq.clear(); start(targets);
+    for (int s : srcs) { set(s, 0, -1); dq.push_back(s); }
+    while (!dq.empty()) {
+      int v = dq.front(); dq.pop_front();
+      if (done[v] == cur) continue;
+      if (settle(v)) break;
+      for (auto &&e : G[v]) {
+        int w = e.first, nd = D[v] + int(e.second); if (dist(w) > nd) {
+          set(w, nd, v);
+          if (e.second == 0) dq.push_front(w);
+          else dq.push_back(w);
+        }
+      }
+    }
+  }
+};
+
+// Computes a table of the shortest distances from each source vertex to
+//   each target vertex, with the sources split into contiguous chunks that
+//   are processed in parallel, each with its own query workspace
+// Template Arguments:
+//   Query: the query structure, either DijkstraQuery, BFSQuery, or
+//     ZeroOneBFSQuery
+//   Policy: the execution policy, either SerialPolicy or ParallelPolicy
+// Function Arguments:
+//   G: a generic graph structure with the same requirements as in Query
+//   srcs: the source vertices
+//   targets: the target vertices
+//   INF: a value for infinity
+// Return Value:
+//   a table where the jth element of the ith row is the shortest distance
+//     from srcs[i] to targets[j], or INF if unreachable
+// In practice, has a small constant
+// Time Complexity: O(S Q / P) where Q is the time complexity of a single
+//   query, for S sources and P threads
+// Memory Complexity: O(S T + P V) for S sources and T targets
+// Tested:
+//   Fuzz Tested
+template <class Query, class Policy = SerialPolicy, class Graph>
+vector<vector<typename Query::Weight>> distanceTable(
+    const Graph &G, const vector<int> &srcs, const vector<int> &targets,
+    typename Query::Weight INF
+        = numeric_limits<typename Query::Weight>::max()) {
+  vector<vector<typename Query::Weight>> ret(srcs.size());
+  Policy::forRange(0, int(srcs.size()), [&] (int lo, int hi) {
+    Query q(G.size(), INF); vector<int> src(1);
+    for (int i = lo; i < hi; i++) {
+      src[0] = srcs[i]; q.run(G, src, targets);
+      ret[i].reserve(targets.size());
+      for (int t : targets) ret[i].push_back(q.dist(t));
+    }
+  });
+  return ret;
+}
@@ -1,207 +1,421 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "NTT.h"
 using namespace std;
 
+// Arbitrary precision signed integer with the magnitude stored in base 2^32
+// Multiplication uses the schoolbook algorithm for short operands,
+//   Karatsuba's algorithm for medium operands, and a Number Theoretic
+//   Transform over three primes (with each limb split into 16-bit halves and
+//   the results combined with the Chinese Remainder Theorem) for long
+//   operands
+// Division uses Knuth's algorithm D when the divisor or the quotient is
+//   short, and otherwise multiplies by a reciprocal of the divisor computed
+//   with Newton's method, followed by a correction of at most a few steps
+// Conversion to and from decimal strings is done by divide and conquer with
+//   cached powers of 10^9
+// Compound assignment operators modify the magnitude in place whenever
+//   possible, so chains of additions and subtractions do not allocate
+// Division and modulo truncate towards zero, with the sign of the remainder
+//   being the sign of the dividend
+// Constructor Arguments:
+//   v: a long long value
+//   s: a string of decimal digits with an optional sequence of signs
+// Fields:
+//   a: the limbs of the magnitude in base 2^32, least significant first, with
+//     no trailing zeros, and empty for zero
+//   sign: 1 if the value is nonnegative, -1 otherwise
+// Functions:
+//   operator +, -, *, /, %: arithmetic with another BigInt, or a long long
+//     for *, /, and % (where % returns a long long)
+//   operator +=, -=, *=, /=, %=: in place arithmetic
+//   operator <, >, <=, >=, ==, !=: comparison
+//   operator -, abs(): negation and absolute value
+//   divmod(a, b): returns the quotient and remainder of a divided by b
+//   isZero(): returns whether the value is 0
+//   value(): returns the value modulo 2^64 as a long long
+//   gcd(a, b), lcm(a, b): the greatest common divisor and lowest common
+//     multiple of a and b
+//   read(s): sets the value to the decimal string s
+//   write(): returns the decimal string of the value
+//   operator >>, <<: reads from an istream and writes to an ostream
+// In practice, has a small constant
+// Time Complexity:
+//   constructor from long long, isZero, value: O(1)
+//   operator +, -, +=, -=, comparison, negation, abs: O(N)
+//   operator * with a long long, / with a long long, % with a long long: O(N)
+//   operator *, *=: O(N log N)
+//   operator /, %, /=, %=, divmod: O(N log N)
+//   read, write, constructor from string: O(N (log N)^2)
+//   gcd, lcm: O(N^2 log N)
+// Memory Complexity: O(N)
+// Tested:
+//   Fuzz Tested
 struct BigInt {
-    using T = long long; using F = long double;
-    static const constexpr int DIG = 4;
-    static const constexpr T BASE = pow(10, DIG);
-    static const constexpr int KARATSUBA_CUTOFF = 64;
-    static const constexpr F PI = acos(F(-1));
-    vector<T> a; int sign;
-    BigInt() : sign(1) {}
-    BigInt(T v) { *this = v; }
-    BigInt(const string &s) { read(s); }
-    void operator = (const BigInt &v) { sign = v.sign; a = v.a; }
-    void operator = (T v) {
-        sign = 1;
-        if (v < 0) sign = -1, v = -v;
-        a.clear();
-        for (; v > 0; v = v / BASE) a.push_back(v % BASE);
-    }
-    BigInt operator + (const BigInt &v) const {
-        if (sign == v.sign) {
-            BigInt res = v;
-            T carry = 0;
-            for (int i = 0; i < max(int(a.size()), int(v.a.size())) || carry; i++) {
-                if (i == int(res.a.size())) res.a.push_back(0);
-                res.a[i] += carry + (i < int(a.size()) ? a[i] : 0); carry = res.a[i] >= BASE;
-                if (carry) res.a[i] -= BASE;
-            }
-            return res;
-        }
-        return *this - (-v);
-    }
-    BigInt operator - (const BigInt &v) const {
-        if (sign == v.sign) {
-            if (abs() >= v.abs()) {
-                BigInt res = *this;
-                T carry = 0;
-                for (int i = 0; i < int(v.a.size()) || carry; i++) {
-                    res.a[i] -= carry + (i < int(v.a.size()) ? v.a[i] : 0); carry = res.a[i] < 0;
-                    if (carry) res.a[i] += BASE;
-                }
-                res.trim(); return res;
-            }
-            return -(v - *this);
-        }
-        return *this + (-v);
-    }
-    void operator *= (T v) {
-        if (v < 0) sign = -sign, v = -v;
-        T carry = 0;
-        for (int i = 0; i < int(a.size()) || carry; i++) {
-            if (i == int(a.size())) a.push_back(0);
-            T cur = a[i] * v + carry; carry = cur / BASE; a[i] = cur % BASE;
-        }
-        trim();
-    }
-    BigInt operator * (T v) const { BigInt res = *this; res *= v; return res; }
-    friend pair<BigInt, BigInt> divmod(const BigInt &a1, const BigInt &b1) {
-        T norm = BASE / (b1.a.back() + 1); BigInt a = a1.abs() * norm, b = b1.abs() * norm, q, r; q.a.resize(int(a.a.size()));
-        for (int i = int(a.a.size()) - 1; i >= 0; i--) {
-            r *= BASE; r += a.a[i];
-            T s1 = int(r.a.size()) <= int(b.a.size()) ? 0 : r.a[int(b.a.size())];
-            T s2 = int(r.a.size()) <= int(b.a.size()) - 1 ? 0 : r.a[int(b.a.size()) - 1];
-            T d = (BASE * s1 + s2) / b.a.back();
-            r -= b * d;
-            while (r < 0) r += b, --d;
-            q.a[i] = d;
-        }
-        q.sign = a1.sign * b1.sign; r.sign = a1.sign; q.trim(); r.trim(); return make_pair(q, r / norm);
-    }
-    BigInt operator / (const BigInt &v) const { return divmod(*this, v).first; }
-    BigInt operator % (const BigInt &v) const { return divmod(*this, v).second; }
-    void operator /= (T v) {
-        if (v < 0) sign = -sign, v = -v;
-        for (int i = int(a.size()) - 1, rem = 0; i >= 0; i--) {
-            T cur = a[i] + rem * BASE; a[i] = cur / v; rem = cur % v;
-        }
-        trim();
-    }
-    BigInt operator / (T v) const { BigInt res = *this; res /= v; return res; }
-    T operator % (T v) const {
-        if (v < 0) v = -v;
-        T m = 0;
-        for (int i = int(a.size()) - 1; i >= 0; i--) m = (a[i] + m * BASE) % v;
-        return m * sign;
-    }
-    void operator += (const BigInt &v) { *this = *this + v; }
-    void operator -= (const BigInt &v) { *this = *this - v; }
-    void operator *= (const BigInt &v) { *this = *this * v; }
-    void operator /= (const BigInt &v) { *this = *this / v; }
-    bool operator < (const BigInt &v) const {
-        if (sign != v.sign) return sign < v.sign;
-        if (int(a.size()) != int(v.a.size())) return int(a.size()) * sign < int(v.a.size()) * v.sign;
-        for (int i = int(a.size()) - 1; i >= 0; i--) if (a[i] != v.a[i]) return a[i] * sign < v.a[i] * sign;
-        return false;
-    }
-    bool operator > (const BigInt &v) const { return v < *this; }
-    bool operator <= (const BigInt &v) const { return !(v < *this); }
-    bool operator >= (const BigInt &v) const { return !(*this < v); }
-    bool operator == (const BigInt &v) const { return !(*this < v) && !(v < *this); }
-    bool operator != (const BigInt &v) const { return *this < v || v < *this; }
-    void trim() {
-        while (!a.empty() && a.back() == 0) a.pop_back();
-        if (a.empty()) sign = 1;
-    }
-    bool isZero() const { return a.empty() || (int(a.size()) == 1 && !a[0]); }
-    BigInt operator - () const { BigInt res = *this; res.sign = -sign; return res; }
-    BigInt abs() const { BigInt res = *this; res.sign *= res.sign; return res; }
-    T value() const { 
-        T res = 0;
-        for (int i = int(a.size()) - 1; i >= 0; i--) res = res * BASE + a[i];
-        return res * sign;
-    }
-    friend BigInt gcd(const BigInt &a, const BigInt &b) { return b.isZero() ? a : gcd(b, a % b); }
-    friend BigInt lcm(const BigInt &a, const BigInt &b) { return a / gcd(a, b) * b; }
-    void read(const string &s) {
-        sign = 1; a.clear(); int pos = 0;
-        for (; pos < int(s.size()) && (s[pos] == '-' || s[pos] == '+'); ++pos) if (s[pos] == '-') sign = -sign;
-        for (int i = int(s.size()) - 1; i >= pos; i -= DIG) {
-            T x = 0;
-            for (int j = max(pos, i - DIG + 1); j <= i; j++) x = x * 10 + s[j] - '0';
-            a.push_back(x);
-        }
-        trim();
-    }
-    friend istream& operator >> (istream &stream, BigInt &v) { string s; stream >> s; v.read(s); return stream; }
-    string write() const {
-        string ret = "";
-        if (sign == -1) ret.push_back('-');
-        for (char c : to_string(a.empty() ? 0 : a.back())) ret.push_back(c);
-        for (int i = int(a.size()) - 2; i >= 0; i--) {
-            string s = to_string(a[i]);
-            for (int j = int(s.size()); j < DIG; j++) ret.push_back('0');
-            for (char c : s) ret.push_back(c);
-        }
-        return ret;
-    }
-    friend ostream& operator << (ostream &stream, const BigInt &v) { stream << v.write(); return stream; }
-    void fft(vector<complex<F>> &a) const {
-        int N = int(a.size());
-        vector<complex<F>> roots = {complex<F>(0, 0), complex<F>(1, 0)};
-        int len = __builtin_ctz(int(roots.size())); roots.resize(N);
-        for (; (1 << len) < N; len++) {
-            F mnAngle = 2 * PI / (1 << (len + 1));
-            for (int i = 0; i < (1 << (len - 1)); i++) {
-                int ind = (1 << (len - 1)) + i; F ang = mnAngle * (2 * i + 1);
-                roots[2 * ind] = roots[ind]; roots[2 * ind + 1] = complex<F>(cos(ang), sin(ang));
-            }
-        }
-        vector<int> ord(N, 0); len = __builtin_ctz(N);
-        for (int i = 0; i < N; i++) ord[i] = (ord[i >> 1] >> 1) + ((i & 1) << (len - 1));
-        for (int i = 0; i < N; i++) if (i < ord[i]) swap(a[i], a[ord[i]]);
-        for (int len = 1; len < N; len <<= 1) for (int i = 0; i < N; i += len << 1) for (int j = 0; j < len; j++) {
-            complex<F> u = a[i + j], v = a[len + i + j] * roots[len + j]; a[i + j] = u + v; a[len + i + j] = u - v;
-        }
+  using u32 = uint32_t; using u64 = uint64_t; using u128 = __uint128_t;
+  using T = long long; using Mag = vector<u32>;
+  static constexpr int KARATSUBA_CUTOFF = 40, NTT_CUTOFF = 800;
+  static constexpr int DIV_CUTOFF = 64, STR_CUTOFF = 64, MAX_NTT = 1 << 24;
+  static constexpr u32 DEC = 1000000000; static constexpr int DEC_DIG = 9;
+  Mag a; int sign;
+  BigInt() : sign(1) {}
+  BigInt(T v) { *this = v; }
+  BigInt(const string &s) { read(s); }
+  BigInt &operator = (T v) {
+    sign = v < 0 ? -1 : 1; u64 m = v < 0 ? 0 - u64(v) : u64(v); a.clear();
+    for (; m > 0; m >>= 32) a.push_back(u32(m));
+    return *this;
+  }
+  static void trim(Mag &x) {
+    while (!x.empty() && x.back() == 0) x.pop_back();
+  }
+  void trim() { trim(a); if (a.empty()) sign = 1; }
+  static int cmp(const Mag &x, const Mag &y) {
+    if (x.size() != y.size()) return x.size() < y.size() ? -1 : 1;
+    for (int i = int(x.size()) - 1; i >= 0; i--)
+      if (x[i] != y[i]) return x[i] < y[i] ? -1 : 1;
+    return 0;
+  }
+  // x += y * B^k
+  static void add(Mag &x, const u32 *y, int m, int k = 0) {
+    if (int(x.size()) < m + k) x.resize(m + k, 0);
+    u64 c = 0; int i = 0;
+    for (; i < m; i++) {
+      c += u64(x[i + k]) + y[i]; x[i + k] = u32(c); c >>= 32;
     }
-    void multiply_fft(const vector<T> &a, const vector<T> &b, vector<T> &res) const {
-        int N = int(a.size()) + int(b.size());
-        while (N & (N - 1)) N++;
-        vector<complex<F>> f(N, 0);
-        for (int i = 0; i < int(a.size()); i++) f[i].real(a[i]);
-        for (int i = 0; i < int(b.size()); i++) f[i].imag(b[i]);
-        fft(f); complex<F> r(0, F(-0.25) / N);
-        for (int i = 0; i <= N / 2; i++) {
-            int j = (N - i) & (N - 1);
-            complex<F> prod = (f[j] * f[j] - conj(f[i] * f[i])) * r; f[i] = prod; f[j] = conj(prod);
-        }
-        fft(f); res.resize(N); T carry = 0;
-        for (int i = 0; i < N; i++) { res[i] = T(f[i].real() + 0.5) + carry; carry = res[i] / BASE; res[i] %= BASE; }
-    }
-    BigInt operator * (const BigInt &v) const {
-        BigInt res; res.sign = sign * v.sign; multiply_fft(a, v.a, res.a); res.trim(); return res;
-    }
-    BigInt mul_simple(const BigInt &v) const {
-        BigInt res; res.sign = sign * v.sign; res.a.resize(int(a.size()) + int(v.a.size()));
-        for (int i = 0; i < int(a.size()); i++) if (a[i]) {
-            T carry = 0;
-            for (int j = 0; j < int(v.a.size()) || carry; j++) {
-                T cur = res.a[i + j] + a[i] * (j < int(v.a.size()) ? v.a[j] : 0) + carry;
-                carry = cur / BASE; res.a[i + j] = cur % BASE;
-            }
-        }
-        res.trim(); return res;
+    for (i += k; c > 0 && i < int(x.size()); i++) {
+      c += x[i]; x[i] = u32(c); c >>= 32;
+    }
+    if (c > 0) x.push_back(u32(c));
+  }
+  static void add(Mag &x, const Mag &y, int k = 0) {
+    add(x, y.data(), int(y.size()), k);
+  }
+  // x -= y * B^k, requires x >= y * B^k
+  static void sub(Mag &x, const u32 *y, int m, int k = 0) {
+    long long c = 0; int i = 0;
+    for (; i < m; i++) {
+      c += (long long)x[i + k] - y[i]; x[i + k] = u32(c); c >>= 32;
+    }
+    for (i += k; c < 0; i++) {
+      c += x[i]; x[i] = u32(c); c >>= 32;
+    }
+    trim(x);
+  }
+  static void sub(Mag &x, const Mag &y, int k = 0) {
+    sub(x, y.data(), int(y.size()), k);
+  }
+  // x = y - x, requires y >= x
+  static void subRev(Mag &x, const Mag &y) {
+    x.resize(y.size(), 0); long long c = 0;
+    for (int i = 0; i < int(y.size()); i++) {
+      c += (long long)y[i] - x[i]; x[i] = u32(c); c >>= 32;
     }
-    template <class T, class ItA, class ItB, class ItRes> static void karatsuba(int n, ItA a, ItB b, ItRes res) {
-        if (n <= KARATSUBA_CUTOFF) {
-            fill(res, res + n * 2, 0);
-            for (int i = 0; i < n; i++) for (int j = 0; j < n; j++) res[i + j] += a[i] * b[j];
-            return;
+    trim(x);
+  }
+  // x = x * m + c
+  static void mulSmall(Mag &x, u32 m, u32 c = 0) {
+    u64 carry = c;
+    for (auto &&v : x) { carry += u64(v) * m; v = u32(carry); carry >>= 32; }
+    if (carry > 0) x.push_back(u32(carry));
+    trim(x);
+  }
+  // x = x / d, returns x % d
+  static u32 divSmall(Mag &x, u32 d) {
+    u64 r = 0;
+    for (int i = int(x.size()) - 1; i >= 0; i--) {
+      r = (r << 32) | x[i]; x[i] = u32(r / d); r %= d;
+    }
+    trim(x); return u32(r);
+  }
+  static void mulSchoolbook(const u32 *x, int n, const u32 *y, int m,
+                            u32 *res) {
+    fill(res, res + n + m, 0);
+    for (int i = 0; i < n; i++) {
+      u64 c = 0, xi = x[i];
+      for (int j = 0; j < m; j++) {
+        c += xi * y[j] + res[i + j]; res[i + j] = u32(c); c >>= 32;
+      }
+      res[i + m] = u32(c);
+    }
+  }
+  static Mag mulKaratsuba(const u32 *x, int n, const u32 *y, int m) {
+    if (n < m) { swap(x, y); swap(n, m); }
+    Mag res(n + m, 0);
+    if (m <= KARATSUBA_CUTOFF) {
+      mulSchoolbook(x, n, y, m, res.data()); trim(res); return res;
+    }
+    if (n >= m * 2) {
+      for (int i = 0; i < n; i += m)
+        add(res, mulKaratsuba(x + i, min(m, n - i), y, m), i);
+      trim(res); return res;
+    }
+    int k = n / 2, yk = min(k, m);
+    Mag x0(x, x + k), x1(x + k, x + n), y0(y, y + yk), y1(y + yk, y + m);
+    trim(x0); trim(y0);
+    Mag z0 = mul(x0, y0), z2 = mul(x1, y1); add(x0, x1); add(y0, y1);
+    Mag z1 = mul(x0, y0); sub(z1, z0); sub(z1, z2);
+    res.assign(z0.begin(), z0.end()); add(res, z1, k); add(res, z2, k * 2);
+    trim(res); return res;
+  }
+  static Mag mulNTT(const Mag &x, const Mag &y) {
+    static thread_local NTT n1(167772161, 3), n2(469762049, 3);
+    static thread_local NTT n3(754974721, 11);
+    const u64 M1 = 167772161, M2 = 469762049, M3 = 754974721;
+    const u64 R12 = powMod(M1, M2 - 2, M2), R13 = powMod(M1, M3 - 2, M3);
+    const u64 R23 = powMod(M2, M3 - 2, M3); bool eq = &x == &y;
+    vector<u32> A(x.size() * 2), B(y.size() * 2), r1, r2, r3;
+    for (int i = 0; i < int(x.size()); i++) {
+      A[i * 2] = x[i] & 0xFFFF; A[i * 2 + 1] = x[i] >> 16;
+    }
+    for (int i = 0; i < int(y.size()); i++) {
+      B[i * 2] = y[i] & 0xFFFF; B[i * 2 + 1] = y[i] >> 16;
+    }
+    n1.multiply(A, B, r1, eq); n2.multiply(A, B, r2, eq);
+    n3.multiply(A, B, r3, eq); Mag res(x.size() + y.size(), 0); u128 c = 0;
+    for (int i = 0; i < int(res.size()) * 2; i++) {
+      if (i < int(r1.size())) {
+        u64 x1 = r1[i], x2 = (r2[i] + M2 - x1) * R12 % M2;
+        u64 x3 = ((r3[i] + M3 - x1) * R13 % M3 + M3 - x2) * R23 % M3;
+        c += x1 + u128(x2) * M1 + u128(x3) * M1 * M2;
+      }
+      res[i >> 1] |= u32(c & 0xFFFF) << ((i & 1) * 16); c >>= 16;
+    }
+    trim(res); return res;
+  }
+  static Mag mul(const Mag &x, const Mag &y) {
+    int n = x.size(), m = y.size();
+    if (n == 0 || m == 0) return Mag();
+    if (min(n, m) <= NTT_CUTOFF || (n + m) * 2 > MAX_NTT)
+      return mulKaratsuba(x.data(), n, y.data(), m);
+    return mulNTT(x, y);
+  }
+  // Knuth's algorithm D, requires size(y) >= 2 and x >= y
+  static void divKnuth(const Mag &x, const Mag &y, Mag &q, Mag &r) {
+    int n = x.size(), m = y.size(), s = __builtin_clz(y.back());
+    Mag u(n + 1, 0), v(m, 0); q.assign(n - m + 1, 0);
+    for (int i = m - 1; i >= 0; i--)
+      v[i] = u32(((u64(y[i]) << 32 | (i > 0 ? y[i - 1] : 0)) << s) >> 32);
+    for (int i = n; i >= 0; i--) {
+      u64 hi = i < n ? x[i] : 0, lo = i > 0 ? x[i - 1] : 0;
+      u[i] = u32(((hi << 32 | lo) << s) >> 32);
+    }
+    for (int j = n - m; j >= 0; j--) {
+      u64 num = u64(u[j + m]) << 32 | u[j + m - 1];
+      u64 qh = num / v[m - 1], rh = num % v[m - 1];
+      while (qh >> 32 || qh * v[m - 2] > (rh << 32 | u[j + m - 2])) {
+        qh--; if ((rh += v[m - 1]) >> 32) break;
+      }
+      long long b = 0; u64 c = 0;
+      for (int i = 0; i < m; i++) {
+        c += qh * v[i]; b += (long long)u[i + j] - u32(c);
+        u[i + j] = u32(b); b >>= 32; c >>= 32;
+      }
+      b += (long long)u[j + m] - (long long)c; u[j + m] = u32(b);
+      if (b < 0) {
+        qh--; c = 0;
+        for (int i = 0; i < m; i++) {
+          c += u64(u[i + j]) + v[i]; u[i + j] = u32(c); c >>= 32;
         }
-        int k = n / 2; vector<T> tmp(n, 0), c(n, 0); auto atmp = tmp.begin(), btmp = atmp + k;
-        for (int i = 0; i < k; i++) { atmp[i] = a[i] + a[i + k]; btmp[i] = b[i] + b[i + k]; }
-        karatsuba<T>(k, atmp, btmp, c.begin()); karatsuba<T>(k, a, b, res); karatsuba<T>(k, a + k, b + k, res + n);
-        for (int i = 0; i < k; i++) { T t = res[i + k]; res[i + k] += c[i] - res[i] - res[i + k * 2]; res[i + k * 2] += c[i + k] - t - res[i + k * 3]; }
-    }
-    BigInt mul_karatsuba(const BigInt &v) const {
-        vector<T> a(this->a.begin(), this->a.end()), b(v.a.begin(), v.a.end());
-        int n = max(a.size(), b.size());
-        while (n & (n - 1)) n++;
-        a.resize(n, 0); b.resize(n, 0); vector<T> c(n * 2, 0); karatsuba<T>(n, a.begin(), b.begin(), c.begin());
-        T carry = 0; BigInt res; res.sign = sign * v.sign;
-        for (int i = 0; i < n * 2; i++) { T cur = c[i] + carry; res.a.push_back(cur % BASE); carry = T(cur / BASE); }
-        res.trim(); return res;
+        u[j + m] += u32(c);
+      }
+      q[j] = u32(qh);
+    }
+    r.assign(m, 0);
+    for (int i = 0; i < m; i++)
+      r[i] = u32((u64(u[i + 1]) << 32 | u[i]) >> s);
+    trim(q); trim(r);
+  }
+  // the p most significant limbs of y, padded with zeros at the bottom
+  static Mag top(const Mag &y, int p) {
+    int m = y.size(); Mag ret(p, 0);
+    for (int i = 0; i < min(p, m); i++) ret[p - 1 - i] = y[m - 1 - i];
+    return ret;
+  }
+  // returns floor(B^(2p) / top(y, p))
+  static Mag reciprocal(const Mag &y, int p) {
+    Mag yp = top(y, p), one(p * 2 + 1, 0), X, R; one.back() = 1;
+    if (p <= DIV_CUTOFF) { divKnuth(one, yp, X, R); return X; }
+    int h = (p + 5) / 2; Mag Y = reciprocal(y, h), YY = mul(Y, Y);
+    Mag Z = mul(yp, YY);
+    Z.erase(Z.begin(), Z.begin() + min(h * 2, int(Z.size())));
+    X.assign(p - h, 0); X.insert(X.end(), Y.begin(), Y.end());
+    add(X, X); sub(X, Z); R = mul(yp, X);
+    while (cmp(R, one) > 0) { sub(X, Mag(1, 1)); sub(R, yp); }
+    for (sub(one, R); cmp(one, yp) >= 0; sub(one, yp)) add(X, Mag(1, 1));
+    return X;
+  }
+  static void divmodMag(const Mag &x, const Mag &y, Mag &q, Mag &r) {
+    assert(!y.empty());
+    if (cmp(x, y) < 0) { q.clear(); r = x; return; }
+    int n = x.size(), m = y.size();
+    if (m == 1) { q = x; r.assign(1, divSmall(q, y[0])); trim(r); return; }
+    if (m <= DIV_CUTOFF || n - m <= DIV_CUTOFF) {
+      divKnuth(x, y, q, r); return;
+    }
+    int p = n - m + 3; divmodRecip(x, y, reciprocal(y, p), p, q, r);
+  }
+  // requires X = reciprocal(y, p) with p >= size(x) - size(y) + 3
+  static void divmodRecip(const Mag &x, const Mag &y, const Mag &X, int p,
+                          Mag &q, Mag &r) {
+    q = mul(x, X);
+    q.erase(q.begin(), q.begin() + min(p + int(y.size()), int(q.size())));
+    Mag Q = mul(q, y);
+    while (cmp(Q, x) > 0) { sub(q, Mag(1, 1)); sub(Q, y); }
+    r = x; sub(r, Q);
+    while (cmp(r, y) >= 0) { add(q, Mag(1, 1)); sub(r, y); }
+  }
+  static const Mag &pow10(int k) {
+    static thread_local deque<Mag> P{Mag(1, u32(DEC))};
+    while (int(P.size()) <= k) P.push_back(mul(P.back(), P.back()));
+    return P[k];
+  }
+  // appends the decimal digits of x, padded with zeros to exactly len digits
+  //   if len is positive
+  static void toDec(const Mag &x, int len, string &s) {
+    if (int(x.size()) <= STR_CUTOFF) {
+      Mag y = x; string t;
+      while (!y.empty()) {
+        u32 d = divSmall(y, DEC);
+        for (int i = 0; i < DEC_DIG; i++, d /= 10) t.push_back('0' + d % 10);
+      }
+      while (!t.empty() && t.back() == '0') t.pop_back();
+      if (len > 0) t.resize(len, '0');
+      s.append(t.rbegin(), t.rend()); return;
+    }
+    int k = 0; while (int(pow10(k + 1).size()) * 2 <= int(x.size()) + 1) k++;
+    const Mag &y = pow10(k); Mag q, r; int d = DEC_DIG << k;
+    int p = int(x.size()) - int(y.size()) + 3;
+    if (int(y.size()) <= DIV_CUTOFF || p - 3 <= DIV_CUTOFF)
+      divmodMag(x, y, q, r);
+    else {
+      static thread_local deque<pair<int, Mag>> R;
+      while (int(R.size()) <= k) R.emplace_back(0, Mag());
+      if (R[k].first < p) R[k] = make_pair(p, reciprocal(y, p));
+      divmodRecip(x, y, R[k].second, R[k].first, q, r);
+    }
+    toDec(q, len > 0 ? len - d : 0, s); toDec(r, d, s);
+  }
+  // the value of the base 10^9 digits c[lo, hi), most significant first
+  static Mag fromDec(const vector<u32> &c, int lo, int hi) {
+    Mag x;
+    if (hi - lo <= STR_CUTOFF) {
+      for (int i = lo; i < hi; i++) mulSmall(x, DEC, c[i]);
+      return x;
+    }
+    int k = __lg(hi - lo - 1), mid = hi - (1 << k);
+    x = mul(fromDec(c, lo, mid), pow10(k)); add(x, fromDec(c, mid, hi));
+    trim(x); return x;
+  }
+  BigInt &addSigned(const Mag &y, int s) {
+    if (sign == s) add(a, y);
+    else if (cmp(a, y) >= 0) sub(a, y);
+    else { subRev(a, y); sign = s; }
+    trim(); return *this;
+  }
+  BigInt &operator += (const BigInt &v) { return addSigned(v.a, v.sign); }
+  BigInt &operator -= (const BigInt &v) {
+    return addSigned(v.a, v.a.empty() ? 1 : -v.sign);
+  }
+  BigInt &operator *= (const BigInt &v) {
+    a = mul(a, v.a); sign *= v.sign; trim(); return *this;
+  }
+  BigInt &operator *= (T v) {
+    if (v < 0) sign = -sign;
+    u64 m = v < 0 ? 0 - u64(v) : u64(v);
+    if (m >> 32) a = mul(a, Mag{u32(m), u32(m >> 32)});
+    else mulSmall(a, u32(m));
+    trim(); return *this;
+  }
+  friend pair<BigInt, BigInt> divmod(const BigInt &a, const BigInt &b) {
+    pair<BigInt, BigInt> ret; divmodMag(a.a, b.a, ret.first.a, ret.second.a);
+    ret.first.sign = a.sign * b.sign; ret.second.sign = a.sign;
+    ret.first.trim(); ret.second.trim(); return ret;
+  }
+  BigInt &operator /= (const BigInt &v) {
+    Mag x, r; x.swap(a); divmodMag(x, this == &v ? x : v.a, a, r);
+    sign *= v.sign; trim(); return *this;
+  }
+  BigInt &operator %= (const BigInt &v) {
+    Mag x, q; x.swap(a); divmodMag(x, this == &v ? x : v.a, q, a);
+    trim(); return *this;
+  }
+  BigInt &operator /= (T v) {
+    if (v < 0) sign = -sign;
+    u64 m = v < 0 ? 0 - u64(v) : u64(v);
+    if (m >> 32) {
+      Mag x, r; x.swap(a); divmodMag(x, Mag{u32(m), u32(m >> 32)}, a, r);
+    } else divSmall(a, u32(m));
+    trim(); return *this;
+  }
+  T operator % (T v) const {
+    u64 m = v < 0 ? 0 - u64(v) : u64(v), r = 0;
+    for (int i = int(a.size()) - 1; i >= 0; i--)
+      r = u64(((u128(r) << 32) | a[i]) % m);
+    return T(r) * sign;
+  }
+  BigInt operator + (const BigInt &v) const {
+    BigInt r = *this; r += v; return r;
+  }
+  BigInt operator - (const BigInt &v) const {
+    BigInt r = *this; r -= v; return r;
+  }
+  BigInt operator * (const BigInt &v) const {
+    BigInt r; r.a = mul(a, v.a); r.sign = sign * v.sign; r.trim(); return r;
+  }
+  BigInt operator / (const BigInt &v) const { return divmod(*this, v).first; }
+  BigInt operator % (const BigInt &v) const { return divmod(*this, v).second; }
+  BigInt operator * (T v) const { BigInt r = *this; r *= v; return r; }
+  BigInt operator / (T v) const { BigInt r = *this; r /= v; return r; }
+  bool operator < (const BigInt &v) const {
+    if (sign != v.sign) return sign < v.sign;
+    int c = cmp(a, v.a); return sign == 1 ? c < 0 : c > 0;
+  }
+  bool operator > (const BigInt &v) const { return v < *this; }
+  bool operator <= (const BigInt &v) const { return !(v < *this); }
+  bool operator >= (const BigInt &v) const { return !(*this < v); }
+  bool operator == (const BigInt &v) const {
+    return sign == v.sign && a == v.a;
+  }
+  bool operator != (const BigInt &v) const { return !(*this == v); }
+  bool isZero() const { return a.empty(); }
+  BigInt operator - () const {
+    BigInt r = *this; if (!r.a.empty()) r.sign = -sign;
+    return r;
+  }
+  BigInt abs() const { BigInt r = *this; r.sign = 1; return r; }
+  T value() const {
+    u64 r = 0; for (int i = min(int(a.size()), 2) - 1; i >= 0; i--)
+      r = (r << 32) | a[i];
+    return T(r) * sign;
+  }
+  friend BigInt gcd(BigInt a, BigInt b) {
+    while (!b.isZero()) { a %= b; swap(a, b); }
+    return a;
+  }
+  friend BigInt lcm(const BigInt &a, const BigInt &b) {
+    return a / gcd(a, b) * b;
+  }
+  void read(const string &s) {
+    sign = 1; int pos = 0;
+    for (; pos < int(s.size()) && (s[pos] == '-' || s[pos] == '+'); pos++)
+      if (s[pos] == '-') sign = -sign;
+    int len = int(s.size()) - pos, c = (len + DEC_DIG - 1) / DEC_DIG;
+    vector<u32> d(c, 0);
+    for (int i = 0; i < len; i++) {
+      int j = c - 1 - (len - 1 - i) / DEC_DIG;
+      d[j] = d[j] * 10 + s[pos + i] - '0';
     }
+    a = fromDec(d, 0, c); trim();
+  }
+  friend istream &operator >> (istream &stream, BigInt &v) {
+    string s; stream >> s; v.read(s); return stream;
+  }
+  string write() const {
+    if (a.empty()) return "0";
+    string ret = sign == -1 ? "-" : ""; toDec(a, 0, ret); return ret;
+  }
+  friend ostream &operator << (ostream &stream, const BigInt &v) {
+    return stream << v.write();
+  }
 };
@@ -1,50 +1,277 @@
 #pragma once
 #include <bits/stdc++.h>
+#include <immintrin.h>
 using namespace std;
 
-// Fast Fourier Transform
-// Time Complexity of multiplyInteger, multiplyPolynomial: O(N log N) where N = size(a) + size(b)
+// Precomputed plan for the Fast Fourier Transform of a fixed length, using
+//   double precision with the real and imaginary parts stored in separate
+//   arrays
+// The forward transform takes its input in natural order and leaves the
+//   result in bit reversed order, while the inverse transform takes its input
+//   in bit reversed order and leaves the result in natural order, so no
+//   explicit bit reversal permutation is needed for convolutions
+// The butterflies are vectorized with AVX2 if the processor supports it,
+//   and SSE2 otherwise, and passes over short spans are done one cache sized
+//   block at a time
+// A plan is immutable after construction and can be reused by any number of
+//   transforms of the same length
+// Constructor Arguments:
+//   N: the length of the transform, must be a power of 2
+// Fields:
+//   N: the length of the transform
+//   wr: the real parts of the twiddle factors, with wr[k + j] being the real
+//     part of e^(i * PI * j / k) for each power of 2 k < N and 0 <= j < k
+//   wi: the imaginary parts of the twiddle factors, in the same layout as wr
+//   AVX2: whether the AVX2 butterflies are used
+// Functions:
+//   fft(re, im): computes the unnormalized transform in place of the arrays
+//     re and im, each of length N, with the twiddle factors e^(i * PI * j / k)
+//   ifft(re, im): computes the unnormalized inverse transform in place of
+//     the arrays re and im, each of length N
+//   partner(p): returns the index in bit reversed order of the frequency
+//     that is the negation of the frequency at index p
+// In practice, the constructor has a small constant, and fft and ifft have
+//   a very small constant
+// Time Complexity:
+//   constructor, fft, ifft: O(N log N)
+//   partner: O(1)
+// Memory Complexity: O(N)
+// Tested:
+//   Fuzz Tested
+struct FFTPlan {
+  static constexpr int BLOCK = 1 << 12;
+  int N; vector<double> wr, wi; bool AVX2;
+  FFTPlan(int N = 0)
+      : N(N), wr(max(N, 2), 1), wi(max(N, 2), 0),
+        AVX2(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    assert((N & (N - 1)) == 0); if (N < 2) return;
+    int h = N >> 1; const double PI = acos(-1.0);
+    for (int j = 0; j < h; j++) {
+      wr[h + j] = cos(PI * j / h); wi[h + j] = sin(PI * j / h);
+    }
+    for (int k = h >> 1; k > 0; k >>= 1) for (int j = 0; j < k; j++) {
+      wr[k + j] = wr[h + j * (h / k)]; wi[k + j] = wi[h + j * (h / k)];
+    }
+  }
+  static int partner(int p) {
+    return p < 2 ? p : (3 << __lg(p)) - 1 - p;
+  }
+  template <const bool DIT> __attribute__((target("sse2")))
+  void passSSE2(double *re, double *im, int n, int len) const {
+    for (int i = 0; i < n; i += len << 1) for (int j = 0; j < len; j += 2) {
+      double *ar = re + i + j, *ai = im + i + j;
+      double *br = ar + len, *bi = ai + len;
+      __m128d ur = _mm_loadu_pd(ar), ui = _mm_loadu_pd(ai);
+      __m128d xr = _mm_loadu_pd(br), xi = _mm_loadu_pd(bi);
+      __m128d yr = _mm_loadu_pd(&wr[len + j]);
+      __m128d yi = _mm_loadu_pd(&wi[len + j]);
+      if (!DIT) {
+        __m128d dr = _mm_sub_pd(ur, xr), di = _mm_sub_pd(ui, xi);
+        _mm_storeu_pd(ar, _mm_add_pd(ur, xr));
+        _mm_storeu_pd(ai, _mm_add_pd(ui, xi));
+        _mm_storeu_pd(br, _mm_sub_pd(_mm_mul_pd(dr, yr), _mm_mul_pd(di, yi)));
+        _mm_storeu_pd(bi, _mm_add_pd(_mm_mul_pd(dr, yi), _mm_mul_pd(di, yr)));
+        continue;
+      }
+      __m128d vr = _mm_sub_pd(_mm_mul_pd(xr, yr), _mm_mul_pd(xi, yi));
+      __m128d vi = _mm_add_pd(_mm_mul_pd(xr, yi), _mm_mul_pd(xi, yr));
+      _mm_storeu_pd(ar, _mm_add_pd(ur, vr));
+      _mm_storeu_pd(ai, _mm_add_pd(ui, vi));
+      _mm_storeu_pd(br, _mm_sub_pd(ur, vr));
+      _mm_storeu_pd(bi, _mm_sub_pd(ui, vi));
+    }
+  }
+  template <const bool DIT> __attribute__((target("avx2,fma")))
+  void passAVX2(double *re, double *im, int n, int len) const {
+    for (int i = 0; i < n; i += len << 1) for (int j = 0; j < len; j += 4) {
+      double *ar = re + i + j, *ai = im + i + j;
+      double *br = ar + len, *bi = ai + len;
+      __m256d ur = _mm256_loadu_pd(ar), ui = _mm256_loadu_pd(ai);
+      __m256d xr = _mm256_loadu_pd(br), xi = _mm256_loadu_pd(bi);
+      __m256d yr = _mm256_loadu_pd(&wr[len + j]);
+      __m256d yi = _mm256_loadu_pd(&wi[len + j]);
+      if (!DIT) {
+        __m256d dr = _mm256_sub_pd(ur, xr), di = _mm256_sub_pd(ui, xi);
+        _mm256_storeu_pd(ar, _mm256_add_pd(ur, xr));
+        _mm256_storeu_pd(ai, _mm256_add_pd(ui, xi));
+        _mm256_storeu_pd(br, _mm256_fmsub_pd(dr, yr, _mm256_mul_pd(di, yi)));
+        _mm256_storeu_pd(bi, _mm256_fmadd_pd(dr, yi, _mm256_mul_pd(di, yr)));
+        continue;
+      }
+      __m256d vr = _mm256_fmsub_pd(xr, yr, _mm256_mul_pd(xi, yi));
+      __m256d vi = _mm256_fmadd_pd(xr, yi, _mm256_mul_pd(xi, yr));
+      _mm256_storeu_pd(ar, _mm256_add_pd(ur, vr));
+      _mm256_storeu_pd(ai, _mm256_add_pd(ui, vi));
+      _mm256_storeu_pd(br, _mm256_sub_pd(ur, vr));
+      _mm256_storeu_pd(bi, _mm256_sub_pd(ui, vi));
+    }
+  }
+  template <const bool DIT> void pass(double *re, double *im, int n,
+                                      int len) const {
+    if (AVX2) passAVX2<DIT>(re, im, n, len);
+    else passSSE2<DIT>(re, im, n, len);
+  }
+  void fft(double *re, double *im) const {
+    if (N < 4) {
+      if (N == 2) {
+        double r = re[1], m = im[1]; re[1] = re[0] - r; im[1] = im[0] - m;
+        re[0] += r; im[0] += m;
+      }
+      return;
+    }
+    int B = min(N, int(BLOCK));
+    for (int len = N >> 1; len >= B; len >>= 1) pass<false>(re, im, N, len);
+    for (int s = 0; s < N; s += B) {
+      for (int len = B >> 1; len >= 4; len >>= 1)
+        pass<false>(re + s, im + s, B, len);
+      for (int i = s; i < s + B; i += 4) {
+        double *r = re + i, *m = im + i;
+        double r0 = r[0] + r[2], m0 = m[0] + m[2], r2 = r[0] - r[2];
+        double m2 = m[0] - m[2], r1 = r[1] + r[3], m1 = m[1] + m[3];
+        double r3 = m[3] - m[1], m3 = r[1] - r[3];
+        r[0] = r0 + r1; m[0] = m0 + m1; r[1] = r0 - r1; m[1] = m0 - m1;
+        r[2] = r2 + r3; m[2] = m2 + m3; r[3] = r2 - r3; m[3] = m2 - m3;
+      }
+    }
+  }
+  void ifft(double *re, double *im) const {
+    swap(re, im); if (N < 4) {
+      if (N == 2) {
+        double r = re[1], m = im[1]; re[1] = re[0] - r; im[1] = im[0] - m;
+        re[0] += r; im[0] += m;
+      }
+      return;
+    }
+    int B = min(N, int(BLOCK));
+    for (int s = 0; s < N; s += B) {
+      for (int i = s; i < s + B; i += 4) {
+        double *r = re + i, *m = im + i;
+        double r0 = r[0] + r[1], m0 = m[0] + m[1], r1 = r[0] - r[1];
+        double m1 = m[0] - m[1], r2 = r[2] + r[3], m2 = m[2] + m[3];
+        double r3 = r[2] - r[3], m3 = m[2] - m[3];
+        r[0] = r0 + r2; m[0] = m0 + m2; r[2] = r0 - r2; m[2] = m0 - m2;
+        r[1] = r1 - m3; m[1] = m1 + r3; r[3] = r1 + m3; m[3] = m1 - r3;
+      }
+      for (int len = 4; len < B; len <<= 1)
+        pass<true>(re + s, im + s, B, len);
+    }
+    for (int len = B; len < N; len <<= 1) pass<true>(re, im, N, len);
+  }
+};
 
-using F = long double; using C = complex<F>; const int CUTOFF = 150, DIG = 4; const F PI = acos(F(-1));
+// Returns a plan of length N, cached across calls in each thread, so
+//   concurrent calls from different threads do not share a plan
+// Time Complexity: O(N log N) for the first call with each N, O(1) otherwise
+// Memory Complexity: O(N)
+const FFTPlan &getFFTPlan(int N) {
+  static thread_local FFTPlan plans[31];
+  FFTPlan &p = plans[__builtin_ctz(N)];
+  if (p.N != N) p = FFTPlan(N);
+  return p;
+}
 
-void fft(vector<C> &a) {
-    int N = int(a.size()); static vector<C> rt(2, 1); static vector<int> ord;
-    for (static int k = 2; k < N; k <<= 1) {
-        rt.resize(N); C x = polar(F(1), PI / k);
-        for (int i = k; i < (k << 1); i++) rt[i] = i & 1 ? rt[i >> 1] * x : rt[i >> 1];
-    }
-    if (int(ord.size()) != N) {
-        ord.assign(N, 0); int len = __builtin_ctz(N);
-        for (int i = 0; i < N; i++) ord[i] = (ord[i >> 1] >> 1) + ((i & 1) << (len - 1));
-    }
-    for (int i = 0; i < N; i++) if (i < ord[i]) swap(a[i], a[ord[i]]);
-    for (int len = 1; len < N; len <<= 1) for (int i = 0; i < N; i += len << 1) for (int j = 0; j < len; j++) {
-        C u = a[i + j], x = a[len + i + j], y = rt[len + j];
-        C v(real(x) * real(y) - imag(x) * imag(y), real(x) * imag(y) + imag(x) * real(y));
-        a[i + j] = u + v; a[len + i + j] = u - v;
+// Computes the convolution of two arrays using the Fast Fourier Transform
+// If T is integral, the result is rounded, and if the coefficients are too
+//   large for a single transform to round correctly, each coefficient is
+//   split into two halves and four transforms are used instead, which
+//   requires the sum of the squares of the halves times log N to be less
+//   than 9e14, which is checked with an assertion
+// Template Arguments:
+//   T: the type of each element
+// Function Arguments:
+//   a: the first array
+//   b: the second array
+//   res: the resulting array of length size(a) + size(b) - 1
+// In practice, has a small constant
+// Time Complexity: O(N log N) where N = size(a) + size(b)
+// Memory Complexity: O(N)
+// Tested:
+//   Fuzz Tested
+template <class T>
+void convolve(const vector<T> &a, const vector<T> &b, vector<T> &res) {
+  int K = int(a.size()) + int(b.size()) - 1, N = 2, lg = 1;
+  res.assign(max(K, 0), T()); if (a.empty() || b.empty()) return;
+  while (N < K) { N <<= 1; lg++; }
+  const FFTPlan &P = getFFTPlan(N); double sq = 0, mx = 0;
+  for (auto &&x : a) { sq += double(x) * x; mx = max(mx, double(abs(x))); }
+  for (auto &&x : b) { sq += double(x) * x; mx = max(mx, double(abs(x))); }
+  auto rnd = [&] (double x) {
+    return is_integral<T>::value ? T(llround(x)) : T(x);
+  };
+  if (!is_integral<T>::value || sq * lg < 9e14) {
+    vector<double> re(N, 0), im(N, 0);
+    for (int i = 0; i < int(a.size()); i++) re[i] = a[i];
+    for (int i = 0; i < int(b.size()); i++) im[i] = b[i];
+    P.fft(re.data(), im.data()); double s = -0.25 / N;
+    for (int i = 0; i < N; i++) {
+      int j = P.partner(i); if (j < i) continue;
+      double dr = re[i] * re[i] - im[i] * im[i] - re[j] * re[j]
+          + im[j] * im[j];
+      double di = 2 * (re[i] * im[i] + re[j] * im[j]);
+      re[i] = re[j] = -di * s; im[i] = dr * s; im[j] = -dr * s;
     }
+    P.ifft(re.data(), im.data());
+    for (int i = 0; i < K; i++) res[i] = rnd(re[i]);
+    return;
+  }
+  long long cut = max(2LL, (long long)ceil(sqrt(mx))); double sh = 0;
+  vector<double> lr(N, 0), li(N, 0), rr(N, 0), ri(N, 0);
+  vector<double> olr(N), oli(N), osr(N), osi(N);
+  for (int i = 0; i < int(a.size()); i++) {
+    lr[i] = (long long)a[i] / cut; li[i] = (long long)a[i] % cut;
+    sh += lr[i] * lr[i] + li[i] * li[i];
+  }
+  for (int i = 0; i < int(b.size()); i++) {
+    rr[i] = (long long)b[i] / cut; ri[i] = (long long)b[i] % cut;
+    sh += rr[i] * rr[i] + ri[i] * ri[i];
+  }
+  assert(sh * lg < 9e14);
+  P.fft(lr.data(), li.data()); P.fft(rr.data(), ri.data());
+  double s = 0.5 / N;
+  for (int i = 0; i < N; i++) {
+    int j = P.partner(i);
+    double hr = (lr[i] + lr[j]) * s, hi = (li[i] - li[j]) * s;
+    double lwr = (li[i] + li[j]) * s, lwi = (lr[j] - lr[i]) * s;
+    olr[i] = hr * rr[i] - hi * ri[i]; oli[i] = hr * ri[i] + hi * rr[i];
+    osr[i] = lwr * rr[i] - lwi * ri[i]; osi[i] = lwr * ri[i] + lwi * rr[i];
+  }
+  P.ifft(olr.data(), oli.data()); P.ifft(osr.data(), osi.data());
+  for (int i = 0; i < K; i++) {
+    long long hh = llround(olr[i]), hl = llround(oli[i]) + llround(osr[i]);
+    res[i] = T((hh * cut + hl) * cut + llround(osi[i]));
+  }
 }
 
-// multiplies as integers if integerMul is true, multiplies as polynomial otherwise
-template <class T> void multiply(const vector<T> &a, const vector<T> &b, vector<T> &res, bool integerMul) {
-    static T BASE = pow(10LL, DIG); int N = int(a.size()) + int(b.size()) - !integerMul;
-    if (max(int(a.size()), int(b.size())) <= CUTOFF) {
-        vector<T> c(N, 0); T carry = 0;
-        for (int i = 0; i < int(a.size()); i++) for (int j = 0; j < int(b.size()); j++) c[i + j] += a[i] * b[j];
-        res.resize(N, 0); copy(c.begin(), c.end(), res.begin());
-        if (integerMul) for (int i = 0; i < int(res.size()); i++) { res[i] += carry; carry = res[i] / BASE; res[i] %= BASE; }
-        while (int(res.size()) > 1 && res.back() == 0) res.pop_back();
-    }
-    while (N & (N - 1)) N++;
-    vector<C> f(N, C(0, 0));
-    for (int i = 0; i < int(a.size()); i++) f[i].real(a[i]);
-    for (int i = 0; i < int(b.size()); i++) f[i].imag(b[i]);
-    fft(f); C r(0, F(-0.25) / N);
-    for (int i = 0; i <= N / 2; i++) {
-        int j = (N - i) & (N - 1); C prod = (f[j] * f[j] - conj(f[i] * f[i])) * r; f[i] = prod; f[j] = conj(prod);
-    }
-    fft(f); res.resize(N); T carry = 0; bool isIntegral = is_integral<T>::value;
-    if (integerMul) for (int i = 0; i < N; i++) { res[i] = T(real(f[i]) + 0.5) + carry; carry = res[i] / BASE; res[i] %= BASE; }
-    else for (int i = 0; i < N; i++) res[i] = isIntegral ? round(real(f[i])) : real(f[i]);
-    while (int(res.size()) > 1 && res.back() == 0) res.pop_back();
+// Multiplies two polynomials, or two integers stored as arrays of base
+//   10 ^ DIG digits in little endian order, using the Fast Fourier Transform
+// Template Arguments:
+//   T: the type of each element
+// Function Arguments:
+//   a: the first polynomial or integer
+//   b: the second polynomial or integer
+//   res: the product, with leading zeros removed
+//   integerMul: multiplies as integers if true, multiplies as polynomials
+//     otherwise
+// In practice, has a small constant
+// Time Complexity: O(N log N) where N = size(a) + size(b)
+// Memory Complexity: O(N)
+// Tested:
+//   Fuzz Tested
+const int CUTOFF = 150, DIG = 4;
+template <class T> void multiply(const vector<T> &a, const vector<T> &b,
+                                 vector<T> &res, bool integerMul) {
+  static T BASE = pow(10LL, DIG);
+  if (max(int(a.size()), int(b.size())) <= CUTOFF) {
+    vector<T> c(max(int(a.size()) + int(b.size()) - 1, 0), T());
+    for (int i = 0; i < int(a.size()); i++)
+      for (int j = 0; j < int(b.size()); j++) c[i + j] += a[i] * b[j];
+    res = c;
+  } else convolve(a, b, res);
+  if (integerMul) {
+    T carry = 0; for (int i = 0; i < int(res.size()); i++) {
+      res[i] += carry; carry = res[i] / BASE; res[i] %= BASE;
+    }
+    for (; carry > 0; carry /= BASE) res.push_back(carry % BASE);
+  }
+  while (int(res.size()) > 1 && res.back() == 0) res.pop_back();
 }
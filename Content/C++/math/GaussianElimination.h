@@ -1,11 +1,15 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../utils/ThreadPool.h"
 using namespace std;
 
 // Solve the equation Ax = b for Matrix A, and Vectors b, x
+// The update of the rows below each pivot is split into contiguous chunks of rows
+//   by the execution policy Policy (SerialPolicy or ParallelPolicy), and since each
+//   row is updated by a single thread, the result does not depend on the policy
 // Time Complexity: O(N^3)
 // Memory Complexity: O(N^2)
-template <const int MAXN, class T> struct GaussianElimination {
+template <const int MAXN, class T, class Policy = SerialPolicy> struct GaussianElimination {
     T EPS, A[MAXN][MAXN], b[MAXN], x[MAXN]; GaussianElimination(T EPS) : EPS(EPS) {}
     void solve(int N) {
         for (int p = 0; p < N; p++) {
@@ -13,10 +17,12 @@ template <const int MAXN, class T> struct GaussianElimination {
             for (int i = p + 1; i < N; i++) if (abs(A[i][p]) > abs(A[m][p])) m = i;
             swap(A[p], A[m]); swap(b[p], b[m]);
             if (abs(A[p][p]) <= EPS) throw runtime_error("Matrix is singular or nearly singular");
-            for (int i = p + 1; i < N; i++) {
-                T alpha = A[i][p] / A[p][p]; b[i] -= alpha * b[p];
-                for (int j = p; j < N; j++) A[i][j] -= alpha * A[p][j];
-            }
+            Policy::forRange(p + 1, N, [&] (int lo, int hi) {
+                for (int i = lo; i < hi; i++) {
+                    T alpha = A[i][p] / A[p][p]; b[i] -= alpha * b[p];
+                    for (int j = p; j < N; j++) A[i][j] -= alpha * A[p][j];
+                }
+            }, max(1, (1 << 14) / (N - p)));
         }
         fill(x, x + N, 0);
         for (int i = N - 1; i >= 0; i--) {
@@ -1,89 +1,335 @@
 #pragma once
 #include <bits/stdc++.h>
+#include "../utils/ThreadPool.h"
 using namespace std;
 
-// Matrix data structure
-template <class T> struct Matrix : vector<vector<T>> {
-    int N, M; Matrix(int N, int M) : vector<vector<T>>(N, vector<T>(M, 0)), N(N), M(M) {}
+// Matrix data structure with contiguous row-major storage
+// Indices are 0-indexed
+// Template Arguments:
+//   T: the type of each element
+// Constructor Arguments:
+//   N: the number of rows
+//   M: the number of columns
+//   v: the initial value of each element
+// Fields:
+//   N: the number of rows
+//   M: the number of columns
+//   a: a vector of length N * M with the element in row i and column j
+//     stored at index i * M + j
+// Functions:
+//   operator [i]: returns a pointer to the first element of row i, so that
+//     A[i][j] is the element in row i and column j
+// Time Complexity:
+//   constructor: O(NM)
+//   operator []: O(1)
+// Memory Complexity: O(NM)
+// Tested:
+//   Fuzz Tested
+template <class T> struct Matrix {
+  int N, M; vector<T> a;
+  Matrix(int N, int M, const T &v = T()) : N(N), M(M), a(N * M, v) {}
+  T *operator [] (int i) { return a.data() + i * M; }
+  const T *operator [] (int i) const { return a.data() + i * M; }
 };
 
 // Returns the identiy matrix of dimension N
 // Time Complexity: O(N^2)
 template <class T> Matrix<T> identity(int N) {
-    Matrix<T> A(N, N);
-    for (int i = 0; i < N; i++) A[i][i] = 1;
-    return A;
+  Matrix<T> A(N, N); for (int i = 0; i < N; i++) A[i][i] = T(1);
+  return A;
 }
 
+// Returns the transpose of A
+// Time Complexity: O(NM)
 template <class T> Matrix<T> transpose(const Matrix<T> &A) {
-    Matrix<T> C(A.M, A.N);
-    for (int i = 0; i < C.N; i++) for (int j = 0; j < C.M; j++) C[i][j] = A[j][i];
-    return C;
+  Matrix<T> C(A.M, A.N);
+  for (int i = 0; i < A.N; i++)
+    for (int j = 0; j < A.M; j++) C[j][i] = A[i][j];
+  return C;
 }
 
 // Returns A + B
-// Time Complexity: O(N^2)
+// Time Complexity: O(NM)
 template <class T> Matrix<T> add(const Matrix<T> &A, const Matrix<T> &B) {
-    assert(A.N == B.N && A.M == B.M); Matrix<T> C(A.N, A.M);
-    for (int i = 0; i < C.N; i++) for (int j = 0; j < C.M; j++) C[i][j] = A[i][j] + B[i][j];
-    return C;
+  assert(A.N == B.N && A.M == B.M); Matrix<T> C(A.N, A.M);
+  for (int i = 0; i < int(C.a.size()); i++) C.a[i] = A.a[i] + B.a[i];
+  return C;
 }
 
 // Returns A - B
-// Time Complexity: O(N^2)
+// Time Complexity: O(NM)
 template <class T> Matrix<T> sub(const Matrix<T> &A, const Matrix<T> &B) {
-    assert(A.N == B.N && A.M == B.M); Matrix<T> C(A.N, A.M);
-    for (int i = 0; i < C.N; i++) for (int j = 0; j < C.M; j++) C[i][j] = A[i][j] - B[i][j];
-    return C;
+  assert(A.N == B.N && A.M == B.M); Matrix<T> C(A.N, A.M);
+  for (int i = 0; i < int(C.a.size()); i++) C.a[i] = A.a[i] - B.a[i];
+  return C;
 }
 
-// Returns A * B
-// Time Complexity: O(N^3)
-template <class T> Matrix<T> mul(const Matrix<T> &A, const Matrix<T> &B) {
-    assert(A.M == B.N); Matrix<T> C(A.N, B.M);
-    for (int i = 0; i < A.N; i++) for (int j = 0; j < B.M; j++) {
-        T temp = 0;
-        for (int k = 0; k < A.M; k++) temp += A[i][k] * B[k][j];
-        C[i][j] = temp;
+// General matrix multiplication kernels for C = A * B, where A is an N x K
+//   matrix, B is a K x M matrix, both with elements of type S, and C is an
+//   N x M matrix with elements of type U
+// B and C are split into cache sized blocks, and the innermost kernel keeps
+//   a tile of R x W elements of C in registers while streaming through a
+//   row block of A and a column block of B, which allows the compiler to
+//   vectorize the inner loop
+// If FOLD is true, the elements of S are unsigned 32-bit integers, U is an
+//   unsigned 64-bit integer, and after every L products, each accumulator x
+//   is replaced with (x mod 2^32) + floor(x / 2^32) * R32, where
+//   R32 = 2^32 % mod, which defers the reduction modulo mod until the end
+// The kernels are compiled for AVX2 as well, and the AVX2 version is used if
+//   the processor supports it
+// The rows of C are split into contiguous chunks by the execution policy,
+//   and since each element of C is computed by a single thread in the same
+//   order, the result does not depend on the policy
+template <class S, class U> struct GEMM {
+  static constexpr int R = 4, W = (sizeof(S) < 8 ? 32 / sizeof(S) : 4) * 2;
+  static constexpr int KC = 256, NC = 512;
+  __attribute__((always_inline))
+  static inline void fold(U (&)[R][W], U, false_type) {}
+  __attribute__((always_inline))
+  static inline void fold(U (&acc)[R][W], U R32, true_type) {
+    for (int r = 0; r < R; r++) for (int w = 0; w < W; w++)
+      acc[r][w] = (acc[r][w] & 0xFFFFFFFFU) + (acc[r][w] >> 32) * R32;
+  }
+  template <const bool FOLD> __attribute__((always_inline))
+  static inline void kernel(const S *a, int lda, const S *b, int ldb, U *c,
+                            int ldc, int K, int L, U R32) {
+    U acc[R][W];
+    for (int r = 0; r < R; r++) for (int w = 0; w < W; w++)
+      acc[r][w] = c[r * ldc + w];
+    for (int k0 = 0; k0 < K; k0 += L) {
+      for (int k = k0, k1 = min(K, k0 + L); k < k1; k++) {
+        const S *bk = b + k * ldb;
+        for (int r = 0; r < R; r++) {
+          S ar = a[r * lda + k];
+          for (int w = 0; w < W; w++) acc[r][w] += U(ar) * U(bk[w]);
+        }
+      }
+      fold(acc, R32, integral_constant<bool, FOLD>());
+    }
+    for (int r = 0; r < R; r++) for (int w = 0; w < W; w++)
+      c[r * ldc + w] = acc[r][w];
+  }
+  template <const bool FOLD> __attribute__((always_inline))
+  static inline void run(const S *a, const S *b, U *c, int N, int K, int M,
+                         int L, U R32) {
+    for (int jj = 0; jj < M; jj += NC) for (int kk = 0; kk < K; kk += KC) {
+      int je = min(M, jj + NC), kl = min(K, kk + KC) - kk;
+      for (int i = 0; i < N; i += R) for (int j = jj; j < je; j += W)
+        kernel<FOLD>(a + i * K + kk, K, b + kk * M + j, M, c + i * M + j, M,
+                     kl, L, R32);
     }
-    return C;
+  }
+  template <const bool FOLD> __attribute__((target("avx2")))
+  static void runAVX2(const S *a, const S *b, U *c, int N, int K, int M,
+                      int L, U R32) {
+    run<FOLD>(a, b, c, N, K, M, L, R32);
+  }
+  template <const bool FOLD>
+  static void runDefault(const S *a, const S *b, U *c, int N, int K, int M,
+                         int L, U R32) {
+    run<FOLD>(a, b, c, N, K, M, L, R32);
+  }
+  // a is N x K, b is K x M, c is N x M, N is a multiple of R and M is a
+  //   multiple of W
+  template <const bool FOLD, class Policy>
+  static void gemm(const S *a, const S *b, U *c, int N, int K, int M, int L,
+                   U R32) {
+    static bool AVX2 = __builtin_cpu_supports("avx2");
+    int grain = max(1, int((1 << 18) / (max(1LL, 1LL * R * K * M))));
+    Policy::forRange(0, N / R, [&] (int lo, int hi) {
+      const S *al = a + lo * R * K; U *cl = c + lo * R * M;
+      int n = (hi - lo) * R;
+      if (AVX2) runAVX2<FOLD>(al, b, cl, n, K, M, L, R32);
+      else runDefault<FOLD>(al, b, cl, n, K, M, L, R32);
+    }, grain);
+  }
+};
+
+// Returns A * B
+// Template Arguments:
+//   Policy: the execution policy, either SerialPolicy or ParallelPolicy
+// In practice, has a very small constant
+// Time Complexity: O(NKM) for an N x K matrix A and a K x M matrix B
+// Memory Complexity: O(NK + KM + NM)
+// Tested:
+//   Fuzz Tested
+template <class Policy = SerialPolicy, class T>
+Matrix<T> mul(const Matrix<T> &A, const Matrix<T> &B) {
+  assert(A.M == B.N); using G = GEMM<T, T>;
+  int N = A.N, K = A.M, M = B.M, NP = (N + G::R - 1) / G::R * G::R;
+  int MP = (M + G::W - 1) / G::W * G::W;
+  vector<T> a(NP * K, T()), b(K * MP, T()), c(NP * MP, T());
+  copy(A.a.begin(), A.a.end(), a.begin());
+  for (int k = 0; k < K; k++) copy(B[k], B[k] + M, b.begin() + k * MP);
+  G::template gemm<false, Policy>(a.data(), b.data(), c.data(), NP, K, MP,
+                                  max(K, 1), T());
+  Matrix<T> C(N, M);
+  for (int i = 0; i < N; i++)
+    copy(c.begin() + i * MP, c.begin() + i * MP + M, C[i]);
+  return C;
 }
 
-// Returns A * B using the transpose trick and the sqrt caching trick to optimize cache hits
-// Time Complexity: O(N^3)
-template <class T> Matrix<T> mulOpt(const Matrix<T> &A, const Matrix<T> &B, int BSZ) {
-    assert(A.M == B.N); Matrix<T> BP = transpose(B), C(A.N, B.M);
-    for (int i = 0; i < A.N; i += BSZ) for (int j = 0; j < BP.N; j += BSZ) for (int k = 0; k < A.M; k += BSZ) {
-        for (int ii = i, eni = min(i + BSZ, A.N); ii < eni; ii++) for (int jj = j, enj = min(j + BSZ, BP.N); jj < enj; jj++) {
-            T temp = 0;
-            for (int kk = k, enk = min(k + BSZ, A.M); kk < enk; kk++) temp += A[ii][kk] * BP[jj][kk];
-            C[ii][jj] += temp;
-        }
-    }
-    return C;
+// Returns A * B modulo mod, where each element of A and B is in the range
+//   [0, mod), and mod is at most 2^31
+// Products are accumulated in unsigned 64-bit integers and only reduced
+//   modulo mod once per element at the end
+// Template Arguments:
+//   Policy: the execution policy, either SerialPolicy or ParallelPolicy
+// In practice, has a very small constant
+// Time Complexity: O(NKM) for an N x K matrix A and a K x M matrix B
+// Memory Complexity: O(NK + KM + NM)
+// Tested:
+//   Fuzz Tested
+template <class Policy = SerialPolicy, class T>
+Matrix<T> mulMod(const Matrix<T> &A, const Matrix<T> &B, T mod) {
+  assert(A.M == B.N && 0 < mod && (unsigned long long)mod <= (1ULL << 31));
+  using u32 = uint32_t; using u64 = uint64_t; using G = GEMM<u32, u64>;
+  int N = A.N, K = A.M, M = B.M, NP = (N + G::R - 1) / G::R * G::R;
+  int MP = (M + G::W - 1) / G::W * G::W; u64 m = mod, R32 = (1ULL << 32) % m;
+  u64 lim = (~0ULL - (R32 + 1) * (1ULL << 32))
+      / max((m - 1) * (m - 1), u64(1));
+  vector<u32> a(NP * K, 0), b(K * MP, 0); vector<u64> c(NP * MP, 0);
+  copy(A.a.begin(), A.a.end(), a.begin());
+  for (int k = 0; k < K; k++) copy(B[k], B[k] + M, b.begin() + k * MP);
+  G::template gemm<true, Policy>(a.data(), b.data(), c.data(), NP, K, MP,
+                                 int(min(lim, u64(G::KC))), R32);
+  Matrix<T> C(N, M); for (int i = 0; i < N; i++)
+    for (int j = 0; j < M; j++) C[i][j] = T(c[i * MP + j] % m);
+  return C;
+}
+
+// Returns A * B using Strassen's algorithm for matrices with every
+//   dimension larger than CUTOFF, and f(X, Y) to multiply smaller matrices
+// Odd dimensions are padded with zeros
+// Template Arguments:
+//   T: the type of each element
+//   F: the type of f
+//   P: the type of plus
+//   Q: the type of minus
+// Function Arguments:
+//   A: an N x K matrix
+//   B: a K x M matrix
+//   f(X, Y): a function that returns the product of the matrices X and Y
+//   plus(x, y): a function that returns the sum of the elements x and y
+//   minus(x, y): a function that returns the difference of the elements x
+//     and y
+//   CUTOFF: the dimension at or below which f is used
+// In practice, has a small constant, and is faster than f only for large
+//   matrices
+// Time Complexity: O(N^log2(7)) for N x N matrices
+// Memory Complexity: O(N^2)
+// Tested:
+//   Fuzz Tested
+template <class T, class F, class P, class Q>
+Matrix<T> strassen(const Matrix<T> &A, const Matrix<T> &B, F f, P plus,
+                   Q minus, int CUTOFF) {
+  assert(A.M == B.N);
+  if (min(min(A.N, A.M), B.M) <= CUTOFF) return f(A, B);
+  int n = (A.N + 1) / 2, k = (A.M + 1) / 2, m = (B.M + 1) / 2;
+  auto part = [&] (const Matrix<T> &X, int r, int c, int R, int C) {
+    Matrix<T> Y(R, C);
+    for (int i = 0; i < R && r + i < X.N; i++)
+      for (int j = 0; j < C && c + j < X.M; j++) Y[i][j] = X[r + i][c + j];
+    return Y;
+  };
+  auto comb = [&] (const Matrix<T> &X, const Matrix<T> &Y, bool sgn) {
+    Matrix<T> Z(X.N, X.M); for (int i = 0; i < int(Z.a.size()); i++)
+      Z.a[i] = sgn ? plus(X.a[i], Y.a[i]) : minus(X.a[i], Y.a[i]);
+    return Z;
+  };
+  auto rec = [&] (const Matrix<T> &X, const Matrix<T> &Y) {
+    return strassen(X, Y, f, plus, minus, CUTOFF);
+  };
+  Matrix<T> A11 = part(A, 0, 0, n, k), A12 = part(A, 0, k, n, k);
+  Matrix<T> A21 = part(A, n, 0, n, k), A22 = part(A, n, k, n, k);
+  Matrix<T> B11 = part(B, 0, 0, k, m), B12 = part(B, 0, m, k, m);
+  Matrix<T> B21 = part(B, k, 0, k, m), B22 = part(B, k, m, k, m);
+  Matrix<T> M1 = rec(comb(A11, A22, true), comb(B11, B22, true));
+  Matrix<T> M2 = rec(comb(A21, A22, true), B11);
+  Matrix<T> M3 = rec(A11, comb(B12, B22, false));
+  Matrix<T> M4 = rec(A22, comb(B21, B11, false));
+  Matrix<T> M5 = rec(comb(A11, A12, true), B22);
+  Matrix<T> M6 = rec(comb(A21, A11, false), comb(B11, B12, true));
+  Matrix<T> M7 = rec(comb(A12, A22, false), comb(B21, B22, true));
+  Matrix<T> C11 = comb(comb(M1, M4, true), comb(M7, M5, false), true);
+  Matrix<T> C12 = comb(M3, M5, true), C21 = comb(M2, M4, true);
+  Matrix<T> C22 = comb(comb(M1, M2, false), comb(M3, M6, true), true);
+  Matrix<T> C(A.N, B.M);
+  for (int i = 0; i < C.N; i++) for (int j = 0; j < C.M; j++) {
+    const Matrix<T> &X = i < n ? (j < m ? C11 : C12) : (j < m ? C21 : C22);
+    C[i][j] = X[i % n][j % m];
+  }
+  return C;
 }
 
-// Returns A ^ pow
+// Returns A * B using Strassen's algorithm above CUTOFF and mul below it
+// Time Complexity: O(N^log2(7)) for N x N matrices
+// Memory Complexity: O(N^2)
+// Tested:
+//   Fuzz Tested
+template <class Policy = SerialPolicy, class T>
+Matrix<T> mulStrassen(const Matrix<T> &A, const Matrix<T> &B,
+                      int CUTOFF = 512) {
+  return strassen(A, B, [&] (const Matrix<T> &X, const Matrix<T> &Y) {
+    return mul<Policy>(X, Y);
+  }, plus<T>(), minus<T>(), CUTOFF);
+}
+
+// Returns A * B modulo mod using Strassen's algorithm above CUTOFF and
+//   mulMod below it
+// Time Complexity: O(N^log2(7)) for N x N matrices
+// Memory Complexity: O(N^2)
+// Tested:
+//   Fuzz Tested
+template <class Policy = SerialPolicy, class T>
+Matrix<T> mulModStrassen(const Matrix<T> &A, const Matrix<T> &B, T mod,
+                         int CUTOFF = 512) {
+  return strassen(A, B, [&] (const Matrix<T> &X, const Matrix<T> &Y) {
+    return mulMod<Policy>(X, Y, mod);
+  }, [&] (const T &x, const T &y) {
+    return x >= mod - y ? x - (mod - y) : x + y;
+  }, [&] (const T &x, const T &y) {
+    return x >= y ? x - y : x - y + mod;
+  }, CUTOFF);
+}
+
+// Returns A ^ pow, with the multiplications done using the execution
+//   policy Policy
 // Time Complexity: O(N^3 log pow)
-template <class T, class U> Matrix<T> pow(Matrix<T> A, U pow) {
-    assert(A.N == A.M); Matrix<T> x = identity<T>(A.N);
-    for (; pow > 0; pow >>= 1, A = mul(A, A)) if (pow & 1) x = mul(x, A);
-    return x;
+template <class Policy = SerialPolicy, class T, class U>
+Matrix<T> pow(Matrix<T> A, U pow) {
+  assert(A.N == A.M); Matrix<T> x = identity<T>(A.N);
+  for (; pow > 0; pow >>= 1, A = mul<Policy>(A, A))
+    if (pow & 1) x = mul<Policy>(x, A);
+  return x;
+}
+
+// Returns A ^ pow modulo mod, where each element of A is in the range
+//   [0, mod), and mod is at most 2^31, with the multiplications done using
+//   the execution policy Policy
+// Time Complexity: O(N^3 log pow)
+template <class Policy = SerialPolicy, class T, class U>
+Matrix<T> pow(Matrix<T> A, U pow, T mod) {
+  assert(A.N == A.M); Matrix<T> x = identity<T>(A.N);
+  if (mod == 1) return Matrix<T>(A.N, A.N);
+  for (; pow > 0; pow >>= 1, A = mulMod<Policy>(A, A, mod))
+    if (pow & 1) x = mulMod<Policy>(x, A, mod);
+  return x;
 }
 
 // Determinant
 // Time Complexity: O(N^3)
 template <class T> T det(Matrix<T> A) {
-    assert(A.N > 0 && A.N == A.M); T ret = 1;
-    for (int i = 0; i < A.N; i++) {
-        int mx = i;
-        for (int j = i + 1; j < A.N; j++) if (A[j][i] > A[mx][i]) mx = j;
-        if (i != mx) { ret = -ret; A[i].swap(A[mx]); }
-        for (int j = i + 1; j < A.N; j++) {
-            T alpha = A[j][i] / A[i][i];
-            for (int k = i + 1; k < A.N; k++) A[j][k] -= alpha * A[i][k];
-        }
+  assert(A.N > 0 && A.N == A.M); T ret = 1;
+  for (int i = 0; i < A.N; i++) {
+    int mx = i;
+    for (int j = i + 1; j < A.N; j++) if (A[j][i] > A[mx][i]) mx = j;
+    if (i != mx) { ret = -ret; swap_ranges(A[i], A[i] + A.M, A[mx]); }
+    for (int j = i + 1; j < A.N; j++) {
+      T alpha = A[j][i] / A[i][i];
+      for (int k = i + 1; k < A.N; k++) A[j][k] -= alpha * A[i][k];
     }
-    for (int i = 0; i < A.N; i++) ret *= A[i][i];
-    return ret;
+  }
+  for (int i = 0; i < A.N; i++) ret *= A[i][i];
+  return ret;
 }
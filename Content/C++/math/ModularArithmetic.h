@@ -58,6 +58,55 @@ struct Montgomery {
     u128 mul(u128 a, u128 b) { return reduce(u256::mul(a, b)); }
 };
 
+// Montgomery Reduction for an odd 32-bit mod, with mod < 2^30
+// Values are kept lazily in the range [0, 2 * mod) so that sums of two values can be
+//   reduced with a single conditional subtraction
+// mul(a, b) returns a * b * 2^-32 % mod, so multiplying by init(b) multiplies by b
+// Time Complexity: O(1)
+// Required: 0 <= a < 4 * mod and 0 <= b < 2 * mod for mul
+struct Montgomery32 {
+    using u32 = uint32_t; using u64 = uint64_t;
+    u32 mod, ninv, r2;
+    Montgomery32(u32 mod = 1) : mod(mod), ninv(1), r2(-u64(mod) % mod) {
+        // 2^5 = 32, ninv = -mod^-1 mod 2^32
+        for (int i = 0; i < 5; i++) ninv *= 2 - mod * ninv;
+        ninv = -ninv;
+    }
+    u32 reduce(u64 x) const { return (x + u64(u32(x) * ninv) * mod) >> 32; }
+    u32 mul(u32 a, u32 b) const { return reduce(u64(a) * b); }
+    u32 init(u32 x) const { return mul(x, r2); }
+    u32 get(u32 x) const { x = reduce(x); return x >= mod ? x - mod : x; }
+};
+
+// Montgomery Reduction for an odd 64-bit mod
+// Values are kept in the range [0, mod), and any odd mod less than 2^64 is supported
+// mul(a, b) returns a * b * 2^-64 % mod, so multiplying by init(b) multiplies by b
+// Time Complexity: O(1)
+// Required: 0 <= a, b < mod for mul
+struct Montgomery64 {
+    using u64 = uint64_t; using u128 = __uint128_t;
+    u64 mod, inv, r2, one;
+    Montgomery64(u64 mod = 1) : mod(mod), inv(1) {
+        // 2^6 = 64, inv = mod^-1 mod 2^64
+        for (int i = 0; i < 6; i++) inv *= 2 - mod * inv;
+        one = -mod % mod; r2 = u128(one) * one % mod;
+    }
+    u64 reduce(u128 x) const {
+        u64 hi = x >> 64, t = (u128(u64(x) * inv) * mod) >> 64;
+        return hi >= t ? hi - t : hi - t + mod;
+    }
+    u64 mul(u64 a, u64 b) const { return reduce(u128(a) * b); }
+    u64 init(u64 x) const { return mul(x % mod, r2); }
+    u64 get(u64 x) const { return reduce(x); }
+    u64 add(u64 a, u64 b) const { return a >= mod - b ? a - (mod - b) : a + b; }
+    u64 sub(u64 a, u64 b) const { return a >= b ? a - b : a + (mod - b); }
+    u64 pow(u64 a, u64 p) const {
+        u64 x = one;
+        for (; p > 0; p >>= 1, a = mul(a, a)) if (p & 1) x = mul(x, a);
+        return x;
+    }
+};
+
 // Specialization of mulMod for unsigned 128-bit mod
 // Uses Montgomery Reduction 
 // Time Complexity: O(1)
@@ -1,74 +1,246 @@
 #pragma once
 #include <bits/stdc++.h>
+#include <immintrin.h>
 #include "ModularArithmetic.h"
 using namespace std;
 
-// Number Theoretic Transform
-// Time Complexity of multiplyPolynomial: O(N log N) where N = size(a) + size(b)
-
-using T = long long; const int CUTOFF = 150;
-static_assert(is_integral<T>::value, "T must be an integral type");
-
-T primitiveRoot(T p) {
-    vector<T> fact; T phi = p - 1, n = phi;
-    for (T i = 2; i * i <= n; i++) {
-        if (n % i == 0) fact.push_back(i);
-        while (n % i == 0) n /= i;
-    }
-    if (n > 1) fact.push_back(n);
-    for (T res = 2; res <= p; res++) {
-        bool ok = true;
-        for (int i = 0; i < int(fact.size()) && ok; i++) ok &= powMod(res, phi / fact[i], p) != 1;
-        if (ok) return res;
-    }
-    assert(false); return -1;
+// Returns the smallest primitive root of a prime p
+// Time Complexity: O(sqrt p + log p * (number of prime factors of p - 1))
+// Memory Complexity: O(log p)
+template <class T> T primitiveRoot(T p) {
+  vector<T> fact; T phi = p - 1, n = phi;
+  for (T i = 2; i * i <= n; i++) {
+    if (n % i == 0) fact.push_back(i);
+    while (n % i == 0) n /= i;
+  }
+  if (n > 1) fact.push_back(n);
+  for (T res = 2; res <= p; res++) {
+    bool ok = true;
+    for (int i = 0; i < int(fact.size()) && ok; i++)
+      ok &= powMod(res, phi / fact[i], p) != 1;
+    if (ok) return res;
+  }
+  assert(false); return -1;
 }
 
-// MOD = C * 2 ^ K + 1, prime
-// for MOD < 1e9:
+// Number Theoretic Transform over a prime MOD = C * 2 ^ K + 1 < 2 ^ 30,
+//   using 32-bit Montgomery multiplication with lazy reductions, where each
+//   value is kept in the range [0, 2 * MOD) between butterflies
+// The forward transform takes its input in natural order and leaves the
+//   result in bit reversed order, while the inverse transform takes its input
+//   in bit reversed order and leaves the result in natural order
+// The butterflies are vectorized with AVX2 if the processor supports it,
+//   and passes over short spans are done one cache sized block at a time
+// Primes and primitive roots:
 //   C = 119, K = 23 (998244353), primitiveRoot = 3
 //   C = 5, K = 25 (167772161), primitiveRoot = 3
 //   C = 7, K = 26 (469762049), primitiveRoot = 3
-// for MOD > 1e9:
 //   C = 479, K = 21 (1004535809), primitiveRoot = 3
-//   C = 483, K = 21 (1012924417), primitiveRoot = 5
-const T C = 119, K = 23, PK = 1 << K, MOD = C * PK + 1, ROOT = powMod(primitiveRoot(MOD), C, MOD);
-
-void ntt(vector<T> &a) {
-    int N = int(a.size()); static vector<T> rt(2, 1); static vector<int> ord;
-    for (static int k = 2, len = 1; k < N; k <<= 1, len++) {
-        rt.resize(N); T x = powMod(ROOT, PK >> (len + 1), MOD);
-        for (int i = k; i < (k << 1); i++) rt[i] = i & 1 ? mulMod(rt[i >> 1], x, MOD) : rt[i >> 1];
+// Constructor Arguments:
+//   MOD: the prime modulus
+//   G: a primitive root of MOD
+// Fields:
+//   MOD: the prime modulus
+//   K: the largest power of 2 that divides MOD - 1
+//   M: the Montgomery parameters for MOD
+//   rt: the twiddle factors for the forward transform in Montgomery form,
+//     with rt[k + j] being w ^ j for a primitive (2k)th root of unity w
+//   irt: the twiddle factors for the inverse transform, in the same layout
+//     as rt
+//   AVX2: whether the AVX2 butterflies are used
+// Functions:
+//   reserve(N): precomputes the twiddle factors for transforms of length N,
+//     where N is a power of 2 that is at most 2 ^ K
+//   ntt(a, N): computes the transform in place of the array a of length N
+//     with values in the range [0, 2 * MOD), leaving values in the same range
+//   intt(a, N): computes the unnormalized inverse transform in place of the
+//     array a of length N with values in the range [0, 2 * MOD)
+//   multiply(a, b, res, eq): sets res to the product of the polynomials a and
+//     b modulo MOD, eq is used as an optimization if a and b are equal
+// The twiddle factors are extended lazily by multiply, so an NTT object
+//   should not be used by multiple threads at the same time
+// In practice, has a very small constant
+// Time Complexity:
+//   constructor: O(1)
+//   reserve, ntt, intt: O(N log N)
+//   multiply: O(N log N) where N = size(a) + size(b)
+// Memory Complexity: O(N) for the largest N reserved
+// Tested:
+//   Fuzz Tested
+struct NTT {
+  using u32 = uint32_t; using u64 = uint64_t;
+  static constexpr int CUTOFF = 64, BLOCK = 1 << 12;
+  u32 MOD, G; int K; Montgomery32 M; vector<u32> rt, irt; bool AVX2;
+  NTT(u32 MOD = 998244353, u32 G = 3)
+      : MOD(MOD), G(G), K(__builtin_ctz(MOD - 1)), M(MOD), rt(2, M.init(1)),
+        irt(2, M.init(1)), AVX2(__builtin_cpu_supports("avx2")) {
+    assert(MOD < (u32(1) << 30));
+  }
+  void reserve(int N) {
+    if (int(rt.size()) >= N) return;
+    assert(N <= (1 << K)); int h = N >> 1; rt.resize(N); irt.resize(N);
+    u64 w = powMod(u64(G), u64(MOD - 1) / N, u64(MOD));
+    u64 iw = powMod(w, u64(MOD - 2), u64(MOD)), x = 1, ix = 1;
+    for (int j = 0; j < h; j++, x = x * w % MOD, ix = ix * iw % MOD) {
+      rt[h + j] = u32((x << 32) % MOD); irt[h + j] = u32((ix << 32) % MOD);
     }
-    if (int(ord.size()) != N) {
-        ord.assign(N, 0); int len = __builtin_ctz(N);
-        for (int i = 0; i < N; i++) ord[i] = (ord[i >> 1] >> 1) + ((i & 1) << (len - 1));
+    for (int k = h >> 1; k > 0; k >>= 1) for (int j = 0; j < k; j++) {
+      rt[k + j] = rt[h + j * (h / k)]; irt[k + j] = irt[h + j * (h / k)];
     }
-    for (int i = 0; i < N; i++) if (i < ord[i]) swap(a[i], a[ord[i]]);
-    for (int len = 1; len < N; len <<= 1) for (int i = 0; i < N; i += len << 1) for (int j = 0; j < len; j++) {
-        T u = a[i + j], v = mulMod(a[len + i + j], rt[len + j], MOD);
-        a[i + j] = addMod(u, v, MOD); a[len + i + j] = subMod(u, v, MOD);
+  }
+  u32 red2(u32 x) const { return x >= 2 * MOD ? x - 2 * MOD : x; }
+  template <const bool DIT>
+  void passScalar(u32 *a, const u32 *w, int N, int len) const {
+    for (int i = 0; i < N; i += len << 1) for (int j = 0; j < len; j++) {
+      u32 &u = a[i + j], &v = a[i + j + len];
+      if (DIT) {
+        u32 x = M.mul(v, w[len + j]); v = red2(u + 2 * MOD - x);
+        u = red2(u + x);
+      } else {
+        u32 x = u + 2 * MOD - v; u = red2(u + v); v = M.mul(x, w[len + j]);
+      }
     }
-}
-
-// Multiplies 2 polynomials modulo a prime, eq is used as an optimization if a and b are equal
-void multiply(const vector<T> &a, const vector<T> &b, vector<T> &res, bool eq = false) {
-    if (max(int(a.size()), int(b.size())) <= CUTOFF) {
-        vector<T> c(int(a.size()) + int(b.size()) - 1, 0);
-        for (int i = 0; i < int(a.size()); i++) for (int j = 0; j < int(b.size()); j++) {
-            c[i + j] = addMod(c[i + j], mulMod(a[i], b[j], MOD), MOD);
-        }
-        res.resize(int(a.size()) + int(b.size()) - 1, 0); copy(c.begin(), c.end(), res.begin());
-        while (int(res.size()) > 1 && res.back() == 0) res.pop_back();
-        return;
+  }
+  __attribute__((target("avx2")))
+  static __m256i mulAVX2(__m256i a, __m256i b, __m256i mod, __m256i ninv) {
+    __m256i pe = _mm256_mul_epu32(a, b);
+    __m256i po = _mm256_mul_epu32(_mm256_srli_epi64(a, 32),
+                                  _mm256_srli_epi64(b, 32));
+    __m256i qe = _mm256_mul_epu32(_mm256_mul_epu32(pe, ninv), mod);
+    __m256i qo = _mm256_mul_epu32(_mm256_mul_epu32(po, ninv), mod);
+    __m256i re = _mm256_srli_epi64(_mm256_add_epi64(pe, qe), 32);
+    return _mm256_blend_epi32(re, _mm256_add_epi64(po, qo), 0xAA);
+  }
+  template <const bool DIT> __attribute__((target("avx2")))
+  void passAVX2(u32 *a, const u32 *w, int N, int len) const {
+    __m256i mod = _mm256_set1_epi32(MOD), mod2 = _mm256_set1_epi32(2 * MOD);
+    __m256i ninv = _mm256_set1_epi32(M.ninv);
+    for (int i = 0; i < N; i += len << 1) for (int j = 0; j < len; j += 8) {
+      __m256i *pu = (__m256i *)(a + i + j);
+      __m256i *pv = (__m256i *)(a + i + j + len);
+      __m256i u = _mm256_loadu_si256(pu), v = _mm256_loadu_si256(pv);
+      __m256i y = _mm256_loadu_si256((const __m256i *)(w + len + j));
+      if (DIT) {
+        __m256i x = mulAVX2(v, y, mod, ninv), s = _mm256_add_epi32(u, x);
+        __m256i d = _mm256_sub_epi32(_mm256_add_epi32(u, mod2), x);
+        s = _mm256_min_epu32(s, _mm256_sub_epi32(s, mod2));
+        d = _mm256_min_epu32(d, _mm256_sub_epi32(d, mod2));
+        _mm256_storeu_si256(pu, s); _mm256_storeu_si256(pv, d);
+      } else {
+        __m256i s = _mm256_add_epi32(u, v);
+        __m256i d = _mm256_sub_epi32(_mm256_add_epi32(u, mod2), v);
+        s = _mm256_min_epu32(s, _mm256_sub_epi32(s, mod2));
+        _mm256_storeu_si256(pu, s);
+        _mm256_storeu_si256(pv, mulAVX2(d, y, mod, ninv));
+      }
+    }
+  }
+  template <const bool DIT>
+  void pass(u32 *a, const u32 *w, int N, int len) const {
+    if (AVX2 && len >= 8) passAVX2<DIT>(a, w, N, len);
+    else passScalar<DIT>(a, w, N, len);
+  }
+  void ntt(u32 *a, int N) const {
+    int B = min(N, int(BLOCK));
+    for (int len = N >> 1; len >= B; len >>= 1)
+      pass<false>(a, rt.data(), N, len);
+    for (int s = 0; s < N; s += B) for (int len = B >> 1; len >= 1; len >>= 1)
+      pass<false>(a + s, rt.data(), B, len);
+  }
+  void intt(u32 *a, int N) const {
+    int B = min(N, int(BLOCK));
+    for (int s = 0; s < N; s += B) for (int len = 1; len < B; len <<= 1)
+      pass<true>(a + s, irt.data(), B, len);
+    for (int len = B; len < N; len <<= 1) pass<true>(a, irt.data(), N, len);
+  }
+  template <class T> void multiply(const vector<T> &a, const vector<T> &b,
+                                   vector<T> &res, bool eq = false) {
+    int L = int(a.size()) + int(b.size()) - 1, N = 1;
+    if (a.empty() || b.empty()) { res.clear(); return; }
+    if (min(int(a.size()), int(b.size())) <= CUTOFF) {
+      vector<u64> c(L, 0); for (int i = 0; i < int(a.size()); i++) {
+        u64 x = posMod<long long>(a[i], MOD);
+        for (int j = 0; j < int(b.size()); j++)
+          c[i + j] = (c[i + j] + x * posMod<long long>(b[j], MOD)) % MOD;
+      }
+      res.assign(c.begin(), c.end()); return;
     }
-    int N = int(a.size()) + int(b.size()) - 1;
-    while (N & (N - 1)) N++;
-    vector<T> fa(N, 0), fb; copy(a.begin(), a.end(), fa.begin()); ntt(fa);
+    while (N < L) N <<= 1;
+    reserve(N); vector<u32> fa(N, 0), fb;
+    for (int i = 0; i < int(a.size()); i++)
+      fa[i] = posMod<long long>(a[i], MOD);
+    ntt(fa.data(), N);
     if (eq) fb = fa;
-    else { fb.assign(N, 0); copy(b.begin(), b.end(), fb.begin()); ntt(fb); }
-    res.resize(N); T invN = mulInvModPrime(T(N), MOD); res[0] = mulMod(mulMod(fa[0], fb[0], MOD), invN, MOD);
-    for (int i = 1; i < N; i++) res[N - i] = mulMod(mulMod(fa[i], fb[i], MOD), invN, MOD);
-    ntt(res);
-    while (int(res.size()) > 1 && res.back() == 0) res.pop_back();
+    else {
+      fb.assign(N, 0); for (int i = 0; i < int(b.size()); i++)
+        fb[i] = posMod<long long>(b[i], MOD);
+      ntt(fb.data(), N);
+    }
+    u32 c = M.init(M.init(powMod(u64(N), u64(MOD - 2), u64(MOD))));
+    for (int i = 0; i < N; i++) fa[i] = M.mul(M.mul(fa[i], fb[i]), c);
+    intt(fa.data(), N); res.resize(L);
+    for (int i = 0; i < L; i++)
+      res[i] = T(fa[i] >= MOD ? fa[i] - MOD : fa[i]);
+  }
+};
+
+// Multiplies 2 polynomials modulo 998244353, eq is used as an optimization
+//   if a and b are equal
+// Each thread uses its own NTT object, so concurrent calls are safe
+// Trailing zeros of the product are removed
+// Template Arguments:
+//   T: the type of each coefficient
+// Function Arguments:
+//   a: the first polynomial
+//   b: the second polynomial
+//   res: the product of a and b modulo 998244353
+//   eq: whether a and b are equal
+// In practice, has a very small constant
+// Time Complexity: O(N log N) where N = size(a) + size(b)
+// Memory Complexity: O(N)
+// Tested:
+//   Fuzz Tested
+template <class T> void multiply(const vector<T> &a, const vector<T> &b,
+                                 vector<T> &res, bool eq = false) {
+  static thread_local NTT ntt; ntt.multiply(a, b, res, eq);
+  while (int(res.size()) > 1 && res.back() == 0) res.pop_back();
+}
+
+// Multiplies 2 polynomials modulo an arbitrary mod by multiplying modulo
+//   three NTT primes and combining the results with the Chinese Remainder
+//   Theorem using Garner's algorithm
+// Each thread uses its own NTT objects, so concurrent calls are safe
+// Trailing zeros of the product are removed
+// Template Arguments:
+//   T: the type of each coefficient
+// Function Arguments:
+//   a: the first polynomial
+//   b: the second polynomial
+//   res: the product of a and b modulo mod
+//   mod: the modulus, at most 2 ^ 31
+// In practice, has a small constant
+// Time Complexity: O(N log N) where N = size(a) + size(b)
+// Memory Complexity: O(N)
+// Tested:
+//   Fuzz Tested
+template <class T> void multiplyMod(const vector<T> &a, const vector<T> &b,
+                                    vector<T> &res, T mod) {
+  using u64 = uint64_t; const u64 M1 = 167772161, M2 = 469762049;
+  const u64 M3 = 998244353;
+  static thread_local NTT n1(M1, 3), n2(M2, 3), n3(M3, 3);
+  const u64 R12 = powMod(M1, M2 - 2, M2), R13 = powMod(M1, M3 - 2, M3);
+  const u64 R23 = powMod(M2, M3 - 2, M3); vector<u64> r1, r2, r3;
+  vector<u64> A(a.size()), B(b.size());
+  for (int i = 0; i < int(a.size()); i++)
+    A[i] = posMod<long long>(a[i], mod);
+  for (int i = 0; i < int(b.size()); i++)
+    B[i] = posMod<long long>(b[i], mod);
+  n1.multiply(A, B, r1); n2.multiply(A, B, r2); n3.multiply(A, B, r3);
+  u64 M12 = M1 * M2 % u64(mod); res.resize(r1.size());
+  for (int i = 0; i < int(r1.size()); i++) {
+    u64 x1 = r1[i], x2 = (r2[i] + M2 - x1) * R12 % M2;
+    u64 x3 = ((r3[i] + M3 - x1) * R13 % M3 + M3 - x2) * R23 % M3;
+    res[i] = T((x1 + x2 * M1 % u64(mod) + x3 * M12) % u64(mod));
+  }
+  while (int(res.size()) > 1 && res.back() == 0) res.pop_back();
 }
@@ -0,0 +1,198 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "NTT.h"
+using namespace std;
+
+// Truncated polynomial and formal power series operations modulo a prime
+//   MOD = C * 2 ^ K + 1 < 2 ^ 30 using the Number Theoretic Transform
+// Coefficients are stored in increasing order of degree, and each
+//   coefficient is in the range [0, MOD)
+// Template Arguments:
+//   MOD: the prime modulus
+//   G: a primitive root of MOD
+// Constructor Arguments:
+//   same as std::vector<unsigned>
+// Functions:
+//   engine(): returns the NTT engine shared by all polynomials with the same
+//     MOD in the current thread
+//   trim(): removes all trailing zero coefficients and returns a reference
+//     to this polynomial
+//   pre(n): returns this polynomial modulo x^n, padded with zeros to exactly
+//     n coefficients
+//   operator +, -, *: addition, subtraction, and multiplication of
+//     polynomials, as well as multiplication by a scalar
+//   deriv(): returns the derivative of this polynomial
+//   integr(): returns the integral of this polynomial with a constant term
+//     of 0
+//   inv(n): returns the multiplicative inverse of this polynomial modulo
+//     x^n, the constant term must be nonzero
+//   log(n): returns the logarithm of this polynomial modulo x^n, the
+//     constant term must be 1
+//   exp(n): returns the exponential of this polynomial modulo x^n, the
+//     constant term must be 0
+//   sqrt(n): returns the square root of this polynomial modulo x^n with a
+//     constant term of 1, the constant term must be 1
+//   divmod(b): returns the quotient and remainder of this polynomial
+//     divided by b, with trailing zeros removed, b must be nonzero
+//   operator /, %: the quotient and the remainder of division
+//   eval(x): returns the value of this polynomial at each point in x
+//   interpolate(x, y): returns the polynomial P with degree less than size(x)
+//     such that P(x[i]) = y[i], the points in x must be distinct
+//   buildTree(x): returns the subproduct tree of the points x, where the
+//     node i covering the points in the range [l, r] stores the product of
+//     (X - x[j]) for l <= j <= r, with the children 2i and 2i + 1
+// In practice, has a small constant
+// Time Complexity:
+//   trim, pre, operator +, -, deriv, integr: O(N)
+//   operator *, inv, log, exp, sqrt, divmod, operator /, %: O(N log N)
+//   eval, interpolate, buildTree: O(N (log N)^2)
+// Memory Complexity: O(N) for each operation, O(N log N) for eval,
+//   interpolate, buildTree
+// Tested:
+//   Fuzz Tested
+template <const unsigned MOD = 998244353, const unsigned G = 3>
+struct Poly : public vector<unsigned> {
+  using u32 = uint32_t; using u64 = uint64_t; using vector<unsigned>::vector;
+  static constexpr int NAIVE = 32;
+  Poly() {}
+  Poly(const vector<unsigned> &v) : vector<unsigned>(v) {}
+  static NTT &engine() { static thread_local NTT e(MOD, G); return e; }
+  static u32 add(u32 a, u32 b) { return a + b >= MOD ? a + b - MOD : a + b; }
+  static u32 sub(u32 a, u32 b) { return a >= b ? a - b : a + MOD - b; }
+  static u32 mul(u32 a, u32 b) { return u64(a) * b % MOD; }
+  static u32 inverse(u32 a) { return powMod(u64(a), u64(MOD - 2), u64(MOD)); }
+  static void dft(vector<u32> &a, int N) {
+    a.resize(N); engine().reserve(N); engine().ntt(a.data(), N);
+  }
+  static void idft(vector<u32> &a, int N) {
+    engine().intt(a.data(), N); u32 iN = inverse(N);
+    for (auto &&v : a) v = mul(v, iN);
+  }
+  Poly &trim() { while (!empty() && back() == 0) pop_back(); return *this; }
+  Poly pre(int n) const {
+    Poly ret(begin(), begin() + min(n, int(size()))); ret.resize(n, 0);
+    return ret;
+  }
+  Poly operator + (const Poly &p) const {
+    Poly ret = *this; if (ret.size() < p.size()) ret.resize(p.size(), 0);
+    for (int i = 0; i < int(p.size()); i++) ret[i] = add(ret[i], p[i]);
+    return ret;
+  }
+  Poly operator - (const Poly &p) const {
+    Poly ret = *this; if (ret.size() < p.size()) ret.resize(p.size(), 0);
+    for (int i = 0; i < int(p.size()); i++) ret[i] = sub(ret[i], p[i]);
+    return ret;
+  }
+  Poly operator * (const Poly &p) const {
+    Poly ret; engine().multiply(*this, p, ret); return ret;
+  }
+  Poly operator * (u32 c) const {
+    Poly ret = *this; for (auto &&v : ret) v = mul(v, c);
+    return ret;
+  }
+  Poly deriv() const {
+    Poly ret(max(int(size()) - 1, 0));
+    for (int i = 1; i < int(size()); i++) ret[i - 1] = mul((*this)[i], i);
+    return ret;
+  }
+  Poly integr() const {
+    int n = size(); Poly ret(n + 1, 0); vector<u32> iv(n + 1, 1);
+    for (int i = 2; i <= n; i++)
+      iv[i] = mul(MOD - MOD / i, iv[MOD % i]);
+    for (int i = 0; i < n; i++) ret[i + 1] = mul((*this)[i], iv[i + 1]);
+    return ret;
+  }
+  Poly inv(int n) const {
+    assert(!empty() && at(0) != 0); Poly g{inverse(at(0))};
+    for (int k = 1; k < n; k <<= 1) {
+      int N = k << 1; vector<u32> f = pre(N), h = g; dft(f, N); dft(h, N);
+      for (int i = 0; i < N; i++) f[i] = mul(f[i], h[i]);
+      idft(f, N); fill(f.begin(), f.begin() + k, 0); dft(f, N);
+      for (int i = 0; i < N; i++) f[i] = mul(f[i], h[i]);
+      idft(f, N); g.resize(N);
+      for (int i = k; i < N; i++) g[i] = sub(0, f[i]);
+    }
+    return g.pre(n);
+  }
+  Poly log(int n) const {
+    assert(!empty() && at(0) == 1);
+    if (n <= 0) return Poly();
+    return (deriv() * inv(n)).pre(n - 1).integr();
+  }
+  Poly exp(int n) const {
+    assert(empty() || at(0) == 0); Poly g{1};
+    for (int k = 1; k < n; k <<= 1)
+      g = (g * (pre(k << 1) - g.log(k << 1) + Poly{1})).pre(k << 1);
+    return g.pre(n);
+  }
+  Poly sqrt(int n) const {
+    assert(!empty() && at(0) == 1); Poly g{1}; u32 i2 = inverse(2);
+    for (int k = 1; k < n; k <<= 1)
+      g = (g + (pre(k << 1) * g.inv(k << 1)).pre(k << 1)) * i2;
+    return g.pre(n);
+  }
+  pair<Poly, Poly> divmod(Poly b) const {
+    Poly a = *this; a.trim(); b.trim(); assert(!b.empty());
+    if (a.size() < b.size()) return make_pair(Poly(), a);
+    int n = int(a.size()) - int(b.size()) + 1; Poly q;
+    if (int(b.size()) <= NAIVE) {
+      q.assign(n, 0); u32 ib = inverse(b.back());
+      for (int i = n - 1; i >= 0; i--) {
+        u32 c = q[i] = mul(a[i + b.size() - 1], ib);
+        for (int j = 0; j < int(b.size()); j++)
+          a[i + j] = sub(a[i + j], mul(c, b[j]));
+      }
+      a.resize(b.size() - 1); return make_pair(q.trim(), a.trim());
+    }
+    Poly ra(a.rbegin(), a.rend()), rb(b.rbegin(), b.rend());
+    q = (ra.pre(n) * rb.inv(n)).pre(n); reverse(q.begin(), q.end());
+    Poly r = (a - b * q).pre(b.size() - 1);
+    return make_pair(q.trim(), r.trim());
+  }
+  Poly operator / (const Poly &b) const { return divmod(b).first; }
+  Poly operator % (const Poly &b) const { return divmod(b).second; }
+  static void build(vector<Poly> &T, const vector<u32> &x, int i, int l,
+                    int r) {
+    if (l == r) { T[i] = Poly{sub(0, x[l]), 1}; return; }
+    int m = l + (r - l) / 2; build(T, x, i * 2, l, m);
+    build(T, x, i * 2 + 1, m + 1, r); T[i] = T[i * 2] * T[i * 2 + 1];
+  }
+  static vector<Poly> buildTree(const vector<u32> &x) {
+    vector<Poly> T(max(int(x.size()) * 4, 1));
+    if (!x.empty()) build(T, x, 1, 0, int(x.size()) - 1);
+    return T;
+  }
+  void eval(const vector<Poly> &T, const vector<u32> &x, int i, int l, int r,
+            vector<u32> &res) const {
+    if (r - l < NAIVE) {
+      for (int j = l; j <= r; j++) {
+        u32 v = 0; for (int k = int(size()) - 1; k >= 0; k--)
+          v = add(mul(v, x[j]), (*this)[k]);
+        res[j] = v;
+      }
+      return;
+    }
+    int m = l + (r - l) / 2; (*this % T[i * 2]).eval(T, x, i * 2, l, m, res);
+    (*this % T[i * 2 + 1]).eval(T, x, i * 2 + 1, m + 1, r, res);
+  }
+  vector<u32> eval(const vector<u32> &x, const vector<Poly> &T) const {
+    vector<u32> res(x.size(), 0);
+    if (!x.empty()) (*this % T[1]).eval(T, x, 1, 0, int(x.size()) - 1, res);
+    return res;
+  }
+  vector<u32> eval(const vector<u32> &x) const {
+    return eval(x, buildTree(x));
+  }
+  static Poly combine(const vector<Poly> &T, const vector<u32> &w, int i,
+                      int l, int r) {
+    if (l == r) return Poly{w[l]};
+    int m = l + (r - l) / 2; return combine(T, w, i * 2, l, m) * T[i * 2 + 1]
+        + combine(T, w, i * 2 + 1, m + 1, r) * T[i * 2];
+  }
+  static Poly interpolate(const vector<u32> &x, const vector<u32> &y) {
+    assert(x.size() == y.size()); if (x.empty()) return Poly();
+    vector<Poly> T = buildTree(x); vector<u32> w = T[1].deriv().eval(x, T);
+    for (int i = 0; i < int(x.size()); i++) w[i] = mul(y[i], inverse(w[i]));
+    return combine(T, w, 1, 0, int(x.size()) - 1).trim();
+  }
+};
@@ -2,59 +2,40 @@
 #include <bits/stdc++.h>
 #include "ModularArithmetic.h"
 #include "GCD.h"
+#include "../utils/ThreadPool.h"
 #if __cplusplus < 201402L
 #include "../utils/MakeUnique.h"
 #endif
 using namespace std;
 
-// Determines whether x is prime
-// Time Complexity: O(sqrt x)
-// Memory Complexity: O(1)
-bool isPrime(long long x) {
-    if (x < 2) return false;
-    for (long long i = 2; i * i <= x; i++) if (x % i == 0) return false;
-    return true;
-}
-
-// Returns the prime factors of x
-// Time Complexity: O(sqrt x)
-// Memory Complexity: O(log x)
-vector<long long> primeFactor(long long x) {
-    vector<long long> ret;
-    for (long long i = 2; i * i <= x; i++) while (x % i == 0) { ret.push_back(i); x /= i; }
-    if (x > 1) ret.push_back(x);
-    return ret;
-}
-
-// Returns the prime factors of x and the count of each factor
-// Time Complexity: O(sqrt x)
-// Memory Complexity: O(log x)
-vector<pair<long long, int>> primeFactorWithCount(long long x) {
-    vector<pair<long long, int>> ret;
-    for (long long i = 2; i * i <= x; i++) if (x % i == 0) for (ret.emplace_back(i, 0); x % i == 0; x /= i) ret.back().second++;
-    if (x > 1) ret.emplace_back(x, 1);
-    return ret;
-}
-
-// Returns the factors of x
-// Time Complexity: O(sqrt x)
-// Memory Complexity: O(sqrt x)
-vector<long long> factors(long long x) {
-    vector<long long> ret;
-    for (long long i = 1; i * i <= x; i++) if (x % i == 0) { ret.push_back(i); if (x / i != i) ret.push_back(x / i); }
-    return ret;
-}
-
 std::seed_seq seq{
     (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count(),
     (uint64_t)__builtin_ia32_rdtsc(),(uint64_t)(uintptr_t)make_unique<char>().get()
 };
 std::mt19937_64 rng64(seq);
 
+// Deterministic Miller Rabin Primality Test for 64-bit integers using Montgomery
+//   multiplication, the 7 bases are sufficient for all N < 2^64
+// Time Complexity: O(log N)
+// Memory Complexity: O(1)
+bool millerRabin64(uint64_t N) {
+    if (N < 2 || N % 6 % 4 != 1) return (N | 1) == 3;
+    Montgomery64 M(N); int s = __builtin_ctzll(N - 1); uint64_t d = (N - 1) >> s, mone = M.sub(0, M.one);
+    for (uint64_t a : {2ULL, 325ULL, 9375ULL, 28178ULL, 450775ULL, 9780504ULL, 1795265022ULL}) {
+        if (a % N == 0) continue;
+        uint64_t p = M.pow(M.init(a), d); int i = s;
+        while (p != M.one && p != mone && i--) p = M.mul(p, p);
+        if (p != mone && i != s) return false;
+    }
+    return true;
+}
+
 // Determines whether N is prime using the Miller Rabin Primality Test
+// If N fits in 64 bits, millerRabin64 is used and the result is deterministic
 // Time Complexity: iterations * time complexity of powMod
 // Memory Complexity: O(iterations)
 template <class T> bool millerRabin(T N, int iterations = 7) {
+    if (sizeof(T) <= 8) return N > 1 && millerRabin64(N);
     if (N < 2 || N % 6 % 4 != 1) return (N | 1) == 3;
     vector<T> A = {2, 325, 9375, 28178, 450775, 9780504, 1795265022};
     while (int(A.size()) < iterations) A.push_back(uniform_int_distribution<long long>(1795265023, numeric_limits<long long>::max())(rng64));
@@ -143,10 +124,155 @@ template <const int MAXE, const int MAXRANGE> struct SegmentedSieve {
 };
 
 
-// Returns a divisor of N
-// Time Complexity: O(log N)
+// Segmented Sieve of Eratosthenes with a mod 30 wheel to enumerate or count the primes
+//   in a range [lo, hi] with hi up to around 10^12, without storing the entire range
+// Each byte represents the 8 numbers 30k + r with r in {1, 7, 11, 13, 17, 19, 23, 29}, and
+//   the range is sieved one segment of SEG bytes (which fits in the L1 cache) at a time,
+//   starting from a copy of a pattern with the multiples of 7, 11, and 13 removed
+// Each prime p >= 17 is crossed off with 8 strides of p bytes, one for each residue of
+//   the cofactor modulo 30, and the positions carry over between consecutive segments
+// In parallel mode, runs of consecutive segments are sieved on different threads, and the
+//   segments are still passed to the callback in increasing order on the calling thread
+// Template Arguments:
+//   Policy: the execution policy, either SerialPolicy or ParallelPolicy
+// Constructor Arguments:
+//   N: the maximum value of hi
+// Functions:
+//   forEachSegment<Policy>(lo, hi, f): calls f(k, seg, len) for each segment in
+//     increasing order, where seg[i] is the byte for the numbers 30(k + i) + r, for
+//     0 <= i < len, only numbers in the range [30k, 30(k + len)) that are also in the
+//     range [lo, hi] should be considered, and the primes 2, 3, 5, 7, 11, and 13 are
+//     not included
+//   forEach<Policy>(lo, hi, f): calls f(p) for each prime p in the range [lo, hi] in
+//     increasing order
+//   count<Policy>(lo, hi): returns the number of primes in the range [lo, hi]
+//   primes<Policy>(lo, hi): returns a vector of the primes in the range [lo, hi]
+// In practice, has a very small constant
+// Time Complexity:
+//   constructor: O(sqrt N)
+//   forEachSegment, forEach, count, primes: O((hi - lo) log log hi + sqrt hi (hi - lo) / SEG)
+// Memory Complexity: O(sqrt N + SEG) for serial mode, O(sqrt N + SEG * RUN * T) for parallel
+//   mode with T threads, plus O(size of output) for primes
+// Tested:
+//   Fuzz Tested
+struct WheelSieve {
+    static constexpr int SEG = 1 << 15, RUN = 16, PATTERN = 7 * 11 * 13;
+    static constexpr int R[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+    static constexpr int IND[30] = {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 3, 0, 0, 0, 4, 0, 5, 0, 0, 0, 6, 0, 0, 0, 0, 0, 7};
+    long long N; vector<int> small; vector<uint8_t> pattern;
+    WheelSieve(long long N) : N(N), pattern(PATTERN, 0xFF) {
+        int sq = sqrtl(N) + 1; vector<bool> comp(sq + 1, false);
+        for (int i = 2; i <= sq; i++) if (!comp[i]) {
+            if (i >= 17) small.push_back(i);
+            for (long long j = 1LL * i * i; j <= sq; j += i) comp[j] = true;
+        }
+        for (int p : {7, 11, 13}) for (int m = p; m < PATTERN * 30; m += p * 2) if (m % 3 != 0 && m % 5 != 0) pattern[m / 30] &= ~(1 << IND[m % 30]);
+    }
+    // sieves the bytes [k0, k0 + len), calling g(k, seg, segLen) after each segment
+    template <class F> void sieveRun(long long k0, long long len, F g) const {
+        vector<uint8_t> seg(SEG); long long hi = (k0 + len) * 30; int np = 0;
+        while (np < int(small.size()) && 1LL * small[np] * small[np] < hi) np++;
+        vector<long long> nxt(np * 8); vector<uint8_t> mask(np * 8);
+        for (int i = 0; i < np; i++) {
+            long long p = small[i], q0 = max(p, (k0 * 30 + p - 1) / p);
+            for (int j = 0; j < 8; j++) {
+                long long q = q0 + ((R[j] - q0 % 30) % 30 + 30) % 30;
+                nxt[i * 8 + j] = p * q / 30 - k0; mask[i * 8 + j] = ~(1 << IND[p * R[j] % 30]);
+            }
+        }
+        for (long long k = k0; k < k0 + len; k += SEG) {
+            int segLen = int(min((long long) SEG, k0 + len - k));
+            for (int i = 0, o = int(k % PATTERN); i < segLen; ) {
+                int c = min(segLen - i, PATTERN - o); memcpy(seg.data() + i, pattern.data() + o, c); i += c; o = 0;
+            }
+            if (k == 0) seg[0] &= ~1;
+            for (int i = 0; i < np; i++) {
+                int p = small[i]; uint8_t *s = seg.data();
+                for (int j = i * 8; j < i * 8 + 8; j++) {
+                    long long o = nxt[j]; uint8_t m = mask[j];
+                    for (; o < segLen; o += p) s[o] &= m;
+                    nxt[j] = o - segLen;
+                }
+            }
+            g(k, (const uint8_t *) seg.data(), segLen);
+        }
+    }
+    template <class Policy = SerialPolicy, class F> void forEachSegment(long long lo, long long hi, F f) const {
+        assert(hi <= N); lo = max(lo, 0LL); if (lo > hi) return;
+        long long K0 = lo / 30, K1 = hi / 30 + 1; int T = Policy::threads();
+        if (T == 1) { sieveRun(K0, K1 - K0, f); return; }
+        long long runLen = (long long) SEG * RUN, roundLen = runLen * T * 2; vector<uint8_t> buf(min(roundLen, K1 - K0));
+        for (long long k = K0; k < K1; k += roundLen) {
+            long long len = min(roundLen, K1 - k); int runs = int((len + runLen - 1) / runLen);
+            Policy::forRange(0, runs, [&] (int a, int b) {
+                for (int r = a; r < b; r++) sieveRun(k + r * runLen, min(runLen, len - r * runLen), [&] (long long s, const uint8_t *seg, int segLen) {
+                    memcpy(buf.data() + (s - k), seg, segLen);
+                });
+            });
+            for (long long s = 0; s < len; s += SEG) f(k + s, (const uint8_t *) buf.data() + s, int(min((long long) SEG, len - s)));
+        }
+    }
+    template <class Policy = SerialPolicy, class F> void forEach(long long lo, long long hi, F f) const {
+        for (int p : {2, 3, 5, 7, 11, 13}) if (lo <= p && p <= hi) f(p);
+        forEachSegment<Policy>(lo, hi, [&] (long long k, const uint8_t *seg, int len) {
+            for (int i = 0; i < len; i++) for (int v = seg[i]; v > 0; v &= v - 1) {
+                long long p = (k + i) * 30 + R[__builtin_ctz(v)];
+                if (lo <= p && p <= hi) f(p);
+            }
+        });
+    }
+    template <class Policy = SerialPolicy> long long count(long long lo, long long hi) const {
+        long long ret = 0;
+        for (int p : {2, 3, 5, 7, 11, 13}) if (lo <= p && p <= hi) ret++;
+        forEachSegment<Policy>(lo, hi, [&] (long long k, const uint8_t *seg, int len) {
+            int i = 0;
+            for (; i < len && (k + i) * 30 < lo; i++) for (int v = seg[i]; v > 0; v &= v - 1) ret += lo <= (k + i) * 30 + R[__builtin_ctz(v)];
+            for (; i + 8 <= len && (k + i + 8) * 30 <= hi + 1; i += 8) {
+                uint64_t w; memcpy(&w, seg + i, 8); ret += __builtin_popcountll(w);
+            }
+            for (; i < len; i++) for (int v = seg[i]; v > 0; v &= v - 1) ret += (k + i) * 30 + R[__builtin_ctz(v)] <= hi;
+        });
+        return ret;
+    }
+    template <class Policy = SerialPolicy> vector<long long> primes(long long lo, long long hi) const {
+        vector<long long> ret; forEach<Policy>(lo, hi, [&] (long long p) { ret.push_back(p); });
+        return ret;
+    }
+};
+constexpr int WheelSieve::R[8];
+constexpr int WheelSieve::IND[30];
+
+// Returns a nontrivial divisor of an odd composite 64-bit integer N using Brent's variant
+//   of Pollard's Rho algorithm with Montgomery multiplication, where the gcd is only
+//   computed once for every batch of products of differences
+// Time Complexity: O(N ^ (1/4)) expected
+// Memory Complexity: O(1)
+uint64_t pollardsRho64(uint64_t N, int batch = 128) {
+    if (N % 2 == 0) return 2;
+    Montgomery64 M(N);
+    for (uint64_t c = M.one, x0 = M.init(2); ; c = M.add(c, M.one)) {
+        auto f = [&] (uint64_t x) { return M.add(M.mul(x, x), c); };
+        uint64_t x = x0, y = x0, ys = x0, q = M.one, g = 1;
+        for (int r = 1; g == 1; r <<= 1) {
+            x = y;
+            for (int i = 0; i < r; i++) y = f(y);
+            for (int k = 0; k < r && g == 1; k += batch) {
+                ys = y;
+                for (int i = 0; i < min(batch, r - k); i++) { y = f(y); q = M.mul(q, x > y ? x - y : y - x); }
+                g = gcd64(q, N);
+            }
+        }
+        if (g == N) do { ys = f(ys); g = gcd64(x > ys ? x - ys : ys - x, N); } while (g == 1);
+        if (g != N) return g;
+    }
+}
+
+// Returns a nontrivial divisor of a composite N
+// If N fits in 64 bits, pollardsRho64 is used with a batch size of iterations
+// Time Complexity: O(N ^ (1/4)) expected
 // Memory Complexity: O(1)
-template <class T> T pollardsRho(T N, int iterations = 40) {
+template <class T> T pollardsRho(T N, int iterations = 128) {
+    if (sizeof(T) <= 8) return pollardsRho64(N, iterations);
     auto f = [&] (T x) { return mulMod(x, x, N) + 1; };
     T x = 0, y = 0, p = 2, q; int t = 0, i = 1;
     while (t++ % iterations != 0 || gcd(p, N) == 1) {
@@ -157,23 +283,26 @@ template <class T> T pollardsRho(T N, int iterations = 40) {
     return gcd(p, N);
 }
 
-// Returns the prime factors of N
-// Time Complexity: O(x ^ (1/4) * (log x))
+// Returns the prime factors of N in non decreasing order, after removing the factors
+//   less than 64 with trial division
+// Time Complexity: O(x ^ (1/4) * (log x)) expected
 // Memory Complexity: O(log x)
-template <class T> vector<T> pollardsRhoPrimeFactor(T x, int pollardsRhoIters = 40, int millerRabinIters = 7) {
-    vector<T> ret; queue<T> q; q.push(x);
+template <class T> vector<T> pollardsRhoPrimeFactor(T x, int pollardsRhoIters = 128, int millerRabinIters = 7) {
+    vector<T> ret; queue<T> q;
+    for (T p = 2; p < 64 && p * p <= x; p++) while (x % p == 0) { ret.push_back(p); x /= p; }
+    if (x > 1) q.push(x);
     while (!q.empty()) {
         T y = q.front(); q.pop();
-        if (millerRabin(y, millerRabinIters)) ret.push_back(y);
+        if (y < 64 * 64 || millerRabin(y, millerRabinIters)) ret.push_back(y);
         else { q.push(pollardsRho(y, pollardsRhoIters)); q.push(y / q.back()); }
     }
-    return ret;
+    sort(ret.begin(), ret.end()); return ret;
 }
 
 // Returns the prime factors of N and the count of each factor
 // Time Complexity: O(x ^ (1/4) * (log x) ^ 2)
 // Memory Complexity: O(log x)
-template <class T> vector<pair<T, int>> pollardsRhoPrimeFactorWithCount(T x, int pollardsRhoIters = 40, int millerRabinIters = 7) {
+template <class T> vector<pair<T, int>> pollardsRhoPrimeFactorWithCount(T x, int pollardsRhoIters = 128, int millerRabinIters = 7) {
     vector<T> pf = pollardsRhoPrimeFactor(x, pollardsRhoIters, millerRabinIters); sort(pf.begin(), pf.end()); vector<pair<T, int>> ret;
     for (int i = 0, cnt = 0; i < int(pf.size()); i++) {
         cnt++;
@@ -182,6 +311,47 @@ template <class T> vector<pair<T, int>> pollardsRhoPrimeFactorWithCount(T x, int
     return ret;
 }
 
+// Returns the prime factors of each element of xs, using the execution policy Policy
+//   (SerialPolicy or ParallelPolicy) to factor different elements on different threads
+// The result does not depend on the policy
+// Time Complexity: O(sum of x ^ (1/4) * (log x)) expected
+// Memory Complexity: O(size of output)
+template <class Policy = SerialPolicy, class T> vector<vector<T>> pollardsRhoPrimeFactorBatch(const vector<T> &xs, int pollardsRhoIters = 128, int millerRabinIters = 7) {
+    vector<vector<T>> ret(xs.size());
+    Policy::forRange(0, int(xs.size()), [&] (int lo, int hi) {
+        for (int i = lo; i < hi; i++) ret[i] = pollardsRhoPrimeFactor(xs[i], pollardsRhoIters, millerRabinIters);
+    }, 64);
+    return ret;
+}
+
+// Determines whether x is prime
+// Time Complexity: O(log x)
+// Memory Complexity: O(1)
+bool isPrime(long long x) { return millerRabin(x); }
+
+// Returns the prime factors of x in non decreasing order
+// Time Complexity: O(x ^ (1/4) * (log x)) expected
+// Memory Complexity: O(log x)
+vector<long long> primeFactor(long long x) { return pollardsRhoPrimeFactor(x); }
+
+// Returns the prime factors of x and the count of each factor
+// Time Complexity: O(x ^ (1/4) * (log x)) expected
+// Memory Complexity: O(log x)
+vector<pair<long long, int>> primeFactorWithCount(long long x) { return pollardsRhoPrimeFactorWithCount(x); }
+
+// Returns the factors of x in increasing order, or an empty vector if x <= 0
+// Time Complexity: O(x ^ (1/4) * (log x) + number of factors * log(number of factors)) expected
+// Memory Complexity: O(number of factors)
+vector<long long> factors(long long x) {
+    if (x <= 0) return vector<long long>();
+    vector<long long> ret{1};
+    for (auto &&pc : primeFactorWithCount(x)) for (int i = 0, sz = ret.size(); i < sz; i++) {
+        long long v = ret[i];
+        for (int j = 0; j < pc.second; j++) ret.push_back(v *= pc.first);
+    }
+    sort(ret.begin(), ret.end()); return ret;
+}
+
 // Determines the factors of all numbers from 1 to N
 // Time Complexity: O(N log N)
 // Memory Complexity: O(N log N)
@@ -0,0 +1,115 @@
+#pragma once
+#include <bits/stdc++.h>
+#include "SuffixArray.h"
+#include "../datastructures/trees/segmenttrees/WaveletMatrix.h"
+using namespace std;
+
+// FM-Index to count and locate the occurrences of a pattern in a
+//   string/array without storing the string/array or its full suffix array
+// The Burrows-Wheeler transform of the string/array with an appended
+//   sentinel is computed from its suffix array and stored in a wavelet
+//   matrix, and the pattern is matched with backward search, where each
+//   step maps a range of suffixes starting with a suffix of the pattern to
+//   the range starting with the next longer suffix with two occ queries
+// Every suffix array entry that is a multiple of the sample rate is kept,
+//   and the other entries are found by LF-mapping to the previous position
+//   in the string/array until a sampled entry is found
+// Indices are 0-indexed and ranges are inclusive with the exception of
+//   functions that accept two iterators as a parameter, such as
+//   the constructor, which are exclusive
+// Template Arguments:
+//   T: the type of the character/element in the string/array
+// Constructor Arguments:
+//   N: the length of the string/array
+//   f: a generating function that returns the ith element on the ith call
+//   st: an iterator pointing to the first element in the array
+//   en: an iterator pointing to after the last element in the array
+//   SA: a suffix array of the string/array
+//   sampleRate: the distance between sampled suffix array entries
+// Fields:
+//   N: the length of the string/array
+//   alpha: the sorted distinct elements of the string/array
+//   C: C[c] is the number of elements of the string/array with the sentinel
+//     less than the element with code c, where the sentinel has a code of 0
+//     and alpha[i] has a code of i + 1
+//   BWT: a wavelet matrix of the codes of the Burrows-Wheeler transform
+// Functions:
+//   LF(i): returns the row of the suffix array with the sentinel of the
+//     suffix starting one index before the suffix in row i, which must not
+//     start at index 0
+//   range(st, en): returns the half open range [lo, hi) of the rows of the
+//     suffix array with the sentinel that start with the pattern, where
+//     st and en are iterators to the start and end of the pattern
+//   count(st, en): returns the number of occurrences of the pattern, the
+//     empty pattern occurs at all N + 1 positions
+//   locate(st, en): returns the starting indices of the occurrences of the
+//     pattern, in lexicographical order of the suffixes
+// In practice, has a small constant
+// Time Complexity:
+//   constructor: O(S log S) with the alphabet size being O(S)
+//   range, count: O(P log A) for a pattern of length P and alphabet size A
+//   locate: O(P log A + K sampleRate log A) for K occurrences
+// Memory Complexity: O(S log A) bits, approximately
+//   1.125 S (ceil(log2(A + 1)) + 1) + 32 S / sampleRate bits
+// Tested:
+//   Fuzz Tested
+template <class T> struct FMIndex {
+  int N, sampleRate; vector<T> alpha; vector<int> C, samples;
+  WaveletMatrix<int> BWT; RankBitVector sampled;
+  template <class F> FMIndex(int N, F f, int sampleRate = 32)
+      : N(N), sampleRate(sampleRate) {
+    vector<T> S; S.reserve(N); for (int i = 0; i < N; i++) S.push_back(f());
+    vector<int> s = encode(S); vector<T>().swap(S);
+    vector<int> sa = SAIS(s, int(alpha.size())); build(s, sa);
+  }
+  template <class It> FMIndex(It st, It en, int sampleRate = 32)
+      : FMIndex(en - st, [&] { return *st++; }, sampleRate) {}
+  template <const bool USE_SAIS, class Policy>
+  FMIndex(const SuffixArray<T, USE_SAIS, Policy> &SA, int sampleRate = 32)
+      : N(SA.N), sampleRate(sampleRate) {
+    vector<int> s = encode(SA.S), sa(N + 1, N);
+    copy(SA.ind.begin(), SA.ind.end(), sa.begin() + 1); build(s, sa);
+  }
+  vector<int> encode(const vector<T> &S) {
+    alpha = S; sort(alpha.begin(), alpha.end());
+    alpha.erase(unique(alpha.begin(), alpha.end()), alpha.end());
+    vector<int> s(N + 1, 0); for (int i = 0; i < N; i++)
+      s[i] = lower_bound(alpha.begin(), alpha.end(), S[i]) - alpha.begin() + 1;
+    return s;
+  }
+  void build(const vector<int> &s, const vector<int> &sa) {
+    int K = alpha.size(); C.assign(K + 2, 0);
+    for (int i = 0; i <= N; i++) C[s[i] + 1]++;
+    partial_sum(C.begin(), C.end(), C.begin()); int i = 0;
+    BWT = WaveletMatrix<int>(N + 1, [&] {
+      int j = sa[i++]; return j == 0 ? 0 : s[j - 1];
+    });
+    sampled = RankBitVector(N + 1);
+    for (i = 0; i <= N; i++) if (sa[i] % sampleRate == 0) {
+      sampled.set(i); samples.push_back(sa[i]);
+    }
+    sampled.build();
+  }
+  int LF(int i) const { int c = BWT.get(i); return C[c] + BWT.occ(c, i); }
+  template <class It> pair<int, int> range(It st, It en) const {
+    int lo = 0, hi = N + 1; while (lo < hi && st != en) {
+      auto it = lower_bound(alpha.begin(), alpha.end(), *--en);
+      if (it == alpha.end() || *en < *it) return make_pair(0, 0);
+      int c = it - alpha.begin() + 1;
+      lo = C[c] + BWT.occ(c, lo); hi = C[c] + BWT.occ(c, hi);
+    }
+    return lo < hi ? make_pair(lo, hi) : make_pair(0, 0);
+  }
+  template <class It> int count(It st, It en) const {
+    pair<int, int> r = range(st, en); return r.second - r.first;
+  }
+  template <class It> vector<int> locate(It st, It en) const {
+    pair<int, int> r = range(st, en); vector<int> ret;
+    ret.reserve(r.second - r.first);
+    for (int i = r.first; i < r.second; i++) {
+      int j = i, k = 0; for (; !sampled.get(j); k++) j = LF(j);
+      ret.push_back(samples[sampled.rank1(j)] + k);
+    }
+    return ret;
+  }
+};
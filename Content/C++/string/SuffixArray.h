@@ -1,15 +1,104 @@
 #pragma once
 #include <bits/stdc++.h>
 #include "../datastructures/FischerHeunStructure.h"
+#include "../utils/ThreadPool.h"
 using namespace std;
 
-// Suffix Array using Sadakane's algorithm to sort suffixes of a string in
-//   lexicographical order
+// Computes the suffix array of an array s with each element in the range
+//   [0, upper] using the SA-IS algorithm, which classifies each suffix as
+//   S-type or L-type, sorts the leftmost S-type (LMS) substrings by induced
+//   sorting, recursively sorts the reduced string of LMS substrings if they
+//   are not distinct, and induces the order of all suffixes from the sorted
+//   LMS suffixes
+// Function Arguments:
+//   s: the array
+//   upper: the maximum value of an element in s
+// Return Value:
+//   a vector of the starting indices of the suffixes of s in lexicographical
+//     order
+// In practice, has a small constant
+// Time Complexity: O(S + upper)
+// Memory Complexity: O(S + upper)
+// Tested:
+//   Fuzz and Stress Tested
+vector<int> SAIS(const vector<int> &s, int upper) {
+  int n = s.size(); vector<int> sa(n, -1);
+  if (n <= 2) {
+    for (int i = 0; i < n; i++) sa[i] = i;
+    if (n == 2 && s[0] >= s[1]) swap(sa[0], sa[1]);
+    return sa;
+  }
+  vector<char> ls(n, 0); vector<int> sumL(upper + 2, 0), sumS(upper + 2, 0);
+  for (int i = n - 2; i >= 0; i--)
+    ls[i] = s[i] == s[i + 1] ? ls[i + 1] : s[i] < s[i + 1];
+  for (int i = 0; i < n; i++) {
+    if (!ls[i]) sumS[s[i]]++;
+    else sumL[s[i] + 1]++;
+  }
+  for (int i = 0; i <= upper; i++) {
+    sumS[i] += sumL[i]; sumL[i + 1] += sumS[i];
+  }
+  vector<int> buf(upper + 2);
+  auto induce = [&] (const vector<int> &lms) {
+    fill(sa.begin(), sa.end(), -1);
+    copy(sumS.begin(), sumS.end(), buf.begin());
+    for (int d : lms) if (d != n) sa[buf[s[d]]++] = d;
+    copy(sumL.begin(), sumL.end(), buf.begin()); sa[buf[s[n - 1]]++] = n - 1;
+    for (int i = 0; i < n; i++) {
+      int v = sa[i]; if (v >= 1 && !ls[v - 1]) sa[buf[s[v - 1]]++] = v - 1;
+    }
+    copy(sumL.begin(), sumL.end(), buf.begin());
+    for (int i = n - 1; i >= 0; i--) {
+      int v = sa[i]; if (v >= 1 && ls[v - 1]) sa[--buf[s[v - 1] + 1]] = v - 1;
+    }
+  };
+  vector<int> lmsMap(n + 1, -1), lms; int m = 0;
+  for (int i = 1; i < n; i++) if (!ls[i - 1] && ls[i]) lmsMap[i] = m++;
+  lms.reserve(m);
+  for (int i = 1; i < n; i++) if (!ls[i - 1] && ls[i]) lms.push_back(i);
+  induce(lms);
+  if (m > 0) {
+    vector<int> sorted, rec(m); sorted.reserve(m); int recUpper = 0;
+    for (int v : sa) if (lmsMap[v] != -1) sorted.push_back(v);
+    rec[lmsMap[sorted[0]]] = 0;
+    for (int i = 1; i < m; i++) {
+      int l = sorted[i - 1], r = sorted[i];
+      int endL = lmsMap[l] + 1 < m ? lms[lmsMap[l] + 1] : n;
+      int endR = lmsMap[r] + 1 < m ? lms[lmsMap[r] + 1] : n;
+      bool same = endL - l == endR - r;
+      if (same) {
+        for (; l < endL && s[l] == s[r]; l++, r++);
+        if (l == n || s[l] != s[r]) same = false;
+      }
+      if (!same) recUpper++;
+      rec[lmsMap[sorted[i]]] = recUpper;
+    }
+    vector<int> recSA = SAIS(rec, recUpper);
+    for (int i = 0; i < m; i++) sorted[i] = lms[recSA[i]];
+    induce(sorted);
+  }
+  return sa;
+}
+
+// Suffix Array to sort suffixes of a string in lexicographical order, using
+//   either the SA-IS algorithm or Sadakane's algorithm
+// The LCP array is computed with Kasai's algorithm, which can be split into
+//   contiguous blocks of starting indices, with each block restarting the
+//   running common prefix length from 0, so that the blocks can be computed
+//   in parallel with the same result
 // Indices are 0-indexed and ranges are inclusive with the exception of
 //   functions that accept two iterators as a parameter, such as
 //   the constructor, which are exclusive
 // Template Arguments:
 //   T: the type of the character/element in the string/array
+//   USE_SAIS: whether the SA-IS algorithm is used instead of Sadakane's
+//     algorithm (false by default), the elements are first replaced by their
+//     ranks among the distinct elements, which takes linear time if T is an
+//     integral type with values in a range of length O(S), and O(S log S)
+//     time otherwise, so SA-IS is much faster for small alphabets, but can
+//     be slower than Sadakane's algorithm for large alphabets
+//   Policy: the execution policy for computing the LCP array, either
+//     SerialPolicy or ParallelPolicy
 // Constructor Arguments:
 //   N: the length of the string/array
 //   f: a generating function that returns the ith element on the ith call
@@ -29,7 +118,9 @@ using namespace std;
 //     being 0)
 // In practice, has a very small constant
 // Time Complexity:
-//   constructor: O(S (log S)^2)
+//   constructor: O(S) with SA-IS for integral types with a small range of
+//     values, O(S log S) with SA-IS otherwise, O(S (log S)^2) with
+//     Sadakane's algorithm
 // Memory Complexity: O(S)
 // Tested:
 //   Fuzz and Stress Tested
@@ -39,11 +130,51 @@ using namespace std;
 //   https://dmoj.ca/problem/coci06c5p6
 //   https://dmoj.ca/problem/ccc20j4
 //   https://dmoj.ca/problem/ccc20s3
-template <class T> struct SuffixArray {
+template <class T, const bool USE_SAIS = false, class Policy = SerialPolicy>
+struct SuffixArray {
   int N; vector<T> S; vector<int> ind, rnk, LCP;
   template <class F> SuffixArray(int N, F f)
       : N(N), ind(N + 1), rnk(N + 1), LCP(N + 1) {
     S.reserve(N); for (int i = 0; i < N; i++) S.push_back(f());
+    if (USE_SAIS) buildSAIS();
+    else buildSadakane();
+    Policy::forRange(0, N, [&] (int lo, int hi) {
+      for (int i = lo, k = 0; i < hi; i++) {
+        if (rnk[i] == N - 1) { LCP[rnk[i]] = k = 0; continue; }
+        int j = ind[rnk[i] + 1];
+        while (i + k < N && j + k < N && S[i + k] == S[j + k]) k++;
+        if ((LCP[rnk[i]] = k) > 0) k--;
+      }
+    }, 1 << 16);
+  }
+  template <class It> SuffixArray(It st, It en)
+      : SuffixArray(en - st, [&] { return *st++; }) {}
+  bool denseRanks(vector<int> &s, int &upper, true_type) {
+    auto mm = minmax_element(S.begin(), S.end());
+    if ((unsigned long long)(*mm.second) - (unsigned long long)(*mm.first)
+        >= (unsigned long long)(N) * 4 + 256) return false;
+    int R = int((unsigned long long)(*mm.second)
+                - (unsigned long long)(*mm.first)) + 1;
+    vector<int> id(R, 0);
+    for (int i = 0; i < N; i++) id[int(S[i] - *mm.first)] = 1;
+    for (int i = 0, c = 0; i < R; i++) if (id[i]) id[i] = c++;
+    for (int i = 0; i < N; i++) s[i] = id[int(S[i] - *mm.first)];
+    upper = *max_element(id.begin(), id.end()); return true;
+  }
+  bool denseRanks(vector<int> &, int &, false_type) { return false; }
+  void buildSAIS() {
+    ind.pop_back(); rnk.pop_back(); LCP.pop_back();
+    if (N == 0) return;
+    vector<int> s(N); int upper = 0;
+    if (!denseRanks(s, upper, is_integral<T>())) {
+      vector<int> &P = rnk; iota(P.begin(), P.end(), 0);
+      sort(P.begin(), P.end(), [&] (int a, int b) { return S[a] < S[b]; });
+      for (int i = 0; i < N; i++)
+        s[P[i]] = upper += i > 0 && S[P[i - 1]] < S[P[i]];
+    }
+    ind = SAIS(s, upper); for (int i = 0; i < N; i++) rnk[ind[i]] = i;
+  }
+  void buildSadakane() {
     vector<int> &tmp = LCP; iota(ind.begin(), ind.end(), 0);
     sort(ind.begin(), ind.begin() + N, [&] (int a, int b) {
       return S[a] < S[b];
@@ -62,15 +193,7 @@ template <class T> struct SuffixArray {
       } else if (rnk[ind[r - 1]] != rnk[ind[r]]) l++;
     }
     ind.pop_back(); rnk.pop_back(); tmp.pop_back();
-    for (int i = 0, k = 0; i < N; i++) {
-      if (rnk[i] == N - 1) { LCP[rnk[i]] = k = 0; continue; }
-      int j = ind[rnk[i] + 1];
-      while (i + k < N && j + k < N && S[i + k] == S[j + k]) k++;
-      if ((LCP[rnk[i]] = k) > 0) k--;
-    }
   }
-  template <class It> SuffixArray(It st, It en)
-      : SuffixArray(en - st, [&] { return *st++; }) {}
 };
 
 // Computes the longest common prefix of two suffixes of a string
@@ -81,6 +204,8 @@ template <class T> struct SuffixArray {
 //   the constructor, which are exclusive
 // Template Arguments:
 //   T: the type of the character/element in the string/array
+//   USE_SAIS: whether the suffix array is built with the SA-IS algorithm
+//     instead of Sadakane's algorithm (false by default)
 // Constructor Arguments:
 //   N: the number of elements in the string/array
 //   f: a generating function that returns the ith element on the ith call
@@ -96,15 +221,17 @@ template <class T> struct SuffixArray {
 // In practice, the constructor has a very small constant, lcp has a
 //   moderate constant, still faster than using segment trees
 // Time Complexity:
-//   constructor: O(S (log S)^2)
+//   constructor: O(S (log S)^2) with Sadakane's algorithm, O(S) with SA-IS
+//     for integral types with a small range of values, O(S log S) with SA-IS
+//     otherwise
 //   lcpRnk, lcp: O(1)
 // Memory Complexity: O(S)
 // Tested:
 //   Fuzz and Stress Tested
 //   https://dmoj.ca/problem/ccc20j4
 //   https://dmoj.ca/problem/ccc20s3
-template <class T> struct LongestCommonPrefix {
-  SuffixArray<T> SA; FischerHeunStructure<int, greater<int>> FHS;
+template <class T, const bool USE_SAIS = false> struct LongestCommonPrefix {
+  SuffixArray<T, USE_SAIS> SA; FischerHeunStructure<int, greater<int>> FHS;
   template <class F> LongestCommonPrefix(int N, F f)
     : SA(N, f), FHS(SA.LCP.begin(), SA.LCP.end()) {}
   template <class It> LongestCommonPrefix(It st, It en)
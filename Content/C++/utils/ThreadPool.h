@@ -0,0 +1,146 @@
+#pragma once
+#include <bits/stdc++.h>
+using namespace std;
+
+// A fixed size pool of worker threads that runs a function over contiguous
+//   chunks of a range, with the calling thread processing the first chunk
+// The chunk boundaries only depend on the range, the number of threads,
+//   and the grain size, so any computation where each index is written by
+//   exactly one chunk gives the same result as the serial computation
+// Calls to forRange from inside a worker, or while another thread is using
+//   the pool, run serially on the calling thread
+// Constructor Arguments:
+//   T: the number of threads, including the calling thread, defaults to the
+//     number of hardware threads
+// Functions:
+//   setThreads(T): changes the number of threads to T
+//   threads(): returns the number of threads
+//   forRange(l, r, f, grain): splits the range [l, r) into at most T
+//     contiguous chunks of at least grain indices each, and calls
+//     f(lo, hi) for each chunk [lo, hi), returning once every call is done
+//   global(): returns a pool shared by the entire program
+// In practice, each call to forRange has an overhead of a few microseconds
+// Time Complexity:
+//   constructor, setThreads: O(T)
+//   threads: O(1)
+//   forRange: O(T) plus the time of the slowest chunk
+// Memory Complexity: O(T)
+// Tested:
+//   Fuzz Tested
+struct ThreadPool {
+  vector<thread> workers; mutex mtx, runMtx; condition_variable cv, doneCv;
+  function<void(int)> job; long long gen = 0; int pending = 0;
+  bool stop = false;
+  static bool &inWorker() { static thread_local bool w = false; return w; }
+  ThreadPool(int T = int(thread::hardware_concurrency())) { setThreads(T); }
+  ~ThreadPool() { setThreads(1); }
+  void work(int id, long long seen) {
+    inWorker() = true;
+    while (true) {
+      unique_lock<mutex> lock(mtx);
+      cv.wait(lock, [&] { return stop || gen != seen; });
+      if (stop) return;
+      seen = gen; lock.unlock(); job(id); lock.lock();
+      if (--pending == 0) doneCv.notify_one();
+    }
+  }
+  void setThreads(int T) {
+    lock_guard<mutex> runLock(runMtx);
+    { lock_guard<mutex> lock(mtx); stop = true; }
+    cv.notify_all(); for (auto &&w : workers) w.join();
+    workers.clear(); stop = false;
+    for (int i = 1; i < T; i++)
+      workers.emplace_back(&ThreadPool::work, this, i, gen);
+  }
+  int threads() const { return int(workers.size()) + 1; }
+  template <class F> void forRange(int l, int r, F f, int grain = 1) {
+    unique_lock<mutex> runLock(runMtx, defer_lock); int T = 1;
+    if (!inWorker() && runLock.try_lock())
+      T = min(threads(), (r - l) / max(grain, 1));
+    if (T <= 1) {
+      if (l < r) f(l, r);
+      return;
+    }
+    auto chunk = [&] (int t) {
+      int lo = l + int((long long)(r - l) * t / T);
+      int hi = l + int((long long)(r - l) * (t + 1) / T);
+      if (t < T) f(lo, hi);
+    };
+    {
+      lock_guard<mutex> lock(mtx); job = chunk; pending = threads() - 1;
+      gen++;
+    }
+    cv.notify_all(); chunk(0);
+    unique_lock<mutex> lock(mtx);
+    doneCv.wait(lock, [&] { return pending == 0; });
+  }
+  static ThreadPool &global() { static ThreadPool pool; return pool; }
+};
+
+// Execution policies for functions that support parallel execution
+// SerialPolicy runs everything on the calling thread, and ParallelPolicy
+//   uses the global thread pool
+// Functions:
+//   threads(): returns the number of threads used by forRange
+//   forRange(l, r, f, grain): same as ThreadPool::forRange
+struct SerialPolicy {
+  static int threads() { return 1; }
+  template <class F> static void forRange(int l, int r, F f, int = 1) {
+    if (l < r) f(l, r);
+  }
+};
+
+struct ParallelPolicy {
+  static int threads() { return ThreadPool::global().threads(); }
+  template <class F> static void forRange(int l, int r, F f, int grain = 1) {
+    ThreadPool::global().forRange(l, r, f, grain);
+  }
+};
+
+// Stably partitions the range [l, r) of A so that the elements that satisfy
+//   pred come first, by splitting the range into one chunk for each thread
+//   (with at least grain elements each), where each chunk separates its
+//   elements into tmp, and then each chunk copies them back to their final
+//   positions, so the result does not depend on the number of threads
+// pred is called exactly once for each element, and may be called
+//   concurrently with other elements
+// Template Arguments:
+//   Policy: the execution policy, either SerialPolicy or ParallelPolicy
+// Function Arguments:
+//   A: the vector to partition
+//   l: the inclusive lower bound of the range
+//   r: the exclusive upper bound of the range
+//   tmp: a buffer with a size of at least r
+//   pred: the predicate
+//   grain: the minimum number of elements in each chunk
+// Return Value: the index of the first element in the range that does not
+//   satisfy pred
+// In practice, has a small constant
+// Time Complexity: O(r - l + T) with the work split across T threads
+// Memory Complexity: O(T)
+// Tested:
+//   Fuzz Tested
+template <class Policy, class T, class F>
+int stablePartition(vector<T> &A, int l, int r, vector<T> &tmp, F pred,
+                    int grain = 1 << 12) {
+  int P = max(1, min(Policy::threads(), (r - l) / max(grain, 1)));
+  vector<int> st(P + 1), a(P + 1, 0), b(P + 1, 0);
+  for (int c = 0; c <= P; c++) st[c] = l + int((long long)(r - l) * c / P);
+  Policy::forRange(0, P, [&] (int lo, int hi) {
+    for (int c = lo; c < hi; c++) for (int i = st[c]; i < st[c + 1]; i++) {
+      if (pred(A[i])) tmp[st[c] + a[c + 1]++] = A[i];
+      else tmp[st[c + 1] - ++b[c + 1]] = A[i];
+    }
+  });
+  for (int c = 0; c < P; c++) { a[c + 1] += a[c]; b[c + 1] += b[c]; }
+  Policy::forRange(0, P, [&] (int lo, int hi) {
+    for (int c = lo; c < hi; c++) {
+      int k = a[c + 1] - a[c];
+      copy(tmp.begin() + st[c], tmp.begin() + st[c] + k,
+           A.begin() + l + a[c]);
+      reverse_copy(tmp.begin() + st[c] + k, tmp.begin() + st[c + 1],
+                   A.begin() + l + a[P] + b[c]);
+    }
+  });
+  return l + a[P];
+}
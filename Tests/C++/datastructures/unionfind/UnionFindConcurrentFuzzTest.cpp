@@ -0,0 +1,130 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/datastructures/unionfind/UnionFind.h"
+#include "../../../../Content/C++/datastructures/unionfind/UnionFindConcurrent.h"
+#include "../../../../Content/C++/utils/ThreadPool.h"
+using namespace std;
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e5;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 101;
+    UnionFind uf0(N);
+    UnionFindConcurrent uf1(N);
+    int Q = N == 0 ? 0 : 100 - rng() % 5;
+    vector<int> ans0, ans1;
+    for (int i = 0; i < Q; i++) {
+      int t = rng() % 3, v = rng() % N, w = rng() % N;
+      if (t == 0) {
+        int mn = v;
+        for (int x = 0; x < v; x++) if (uf0.connected(x, v)) { mn = x; break; }
+        ans0.push_back(mn);
+        ans1.push_back(uf1.find(v));
+      } else if (t == 1) {
+        ans0.push_back(uf0.connected(v, w));
+        ans1.push_back(uf1.connected(v, w));
+      } else {
+        ans0.push_back(uf0.join(v, w));
+        ans1.push_back(uf1.join(v, w));
+      }
+      assert(uf0.cnt == uf1.getCnt());
+    }
+    assert(ans0 == ans1);
+    for (auto &&a : ans0) checkSum = 31 * checkSum + a;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (Serial) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1000;
+  long long checkSum = 0;
+  ThreadPool::global().setThreads(4);
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = 1 + rng() % (ti % 50 == 0 ? 100000 : 1000);
+    int Q = rng() % (N * 2 + 1);
+    vector<pair<int, int>> edges(Q);
+    for (auto &&e : edges) e = make_pair(int(rng() % N), int(rng() % N));
+    UnionFind uf0(N);
+    UnionFindConcurrent uf1(N);
+    for (auto &&e : edges) uf0.join(e.first, e.second);
+    vector<int> joined(Q, 0);
+    ThreadPool::global().forRange(0, Q, [&] (int lo, int hi) {
+      for (int i = lo; i < hi; i++) {
+        joined[i] = uf1.join(edges[i].first, edges[i].second);
+        assert(uf1.connected(edges[i].first, edges[i].second));
+      }
+    }, 16);
+    assert(uf0.cnt == uf1.getCnt());
+    assert(accumulate(joined.begin(), joined.end(), 0) == N - uf1.getCnt());
+    vector<int> mn(N, N);
+    for (int v = 0; v < N; v++) mn[uf0.find(v)] = min(mn[uf0.find(v)], v);
+    for (int v = 0; v < N; v++) {
+      assert(uf1.find(v) == mn[uf0.find(v)]);
+      checkSum = 31 * checkSum + uf1.find(v);
+    }
+  }
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Concurrent) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 100;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = 1 + rng() % 10000, T = 2 + rng() % 7, Q = rng() % (N + 1);
+    vector<vector<pair<int, int>>> edges(T);
+    UnionFind uf0(N);
+    for (auto &&E : edges) for (int i = 0; i < Q / T; i++) {
+      int v = rng() % N, w = rng() % N;
+      E.emplace_back(v, w);
+      uf0.join(v, w);
+    }
+    vector<int> root(N);
+    for (int v = 0; v < N; v++) root[v] = uf0.find(v);
+    UnionFindConcurrent uf1(N);
+    vector<thread> producers;
+    for (int t = 0; t < T; t++) producers.emplace_back([&, t] {
+      mt19937_64 qrng(t);
+      for (auto &&e : edges[t]) {
+        uf1.join(e.first, e.second);
+        assert(uf1.connected(e.second, e.first));
+        int v = qrng() % N, w = qrng() % N;
+        if (uf1.connected(v, w)) assert(root[v] == root[w]);
+        assert(uf1.find(v) <= v);
+      }
+    });
+    for (auto &&p : producers) p.join();
+    assert(uf0.cnt == uf1.getCnt());
+    for (int v = 0; v < N; v++) {
+      assert(uf0.connected(v, uf1.find(v)));
+      checkSum = 31 * checkSum + uf1.find(v);
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (Producer Threads) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
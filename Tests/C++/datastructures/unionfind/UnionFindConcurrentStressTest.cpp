@@ -0,0 +1,99 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/datastructures/unionfind/UnionFind.h"
+#include "../../../../Content/C++/datastructures/unionfind/UnionFindConcurrent.h"
+#include "../../../../Content/C++/utils/ThreadPool.h"
+using namespace std;
+
+const int N = 2e6, Q = 1e7;
+vector<pair<int, int>> edges;
+
+void gen() {
+  mt19937_64 rng(0);
+  edges.resize(Q);
+  for (auto &&e : edges) e = make_pair(int(rng() % N), int(rng() % N));
+}
+
+template <class F> void run(int subtest, const string &name, F f) {
+  const auto start_time = chrono::system_clock::now();
+  long long checkSum = f();
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  N: " << N << endl;
+  cout << "  Q: " << Q << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Throughput: " << fixed << setprecision(3) << Q / sec / 1e6 << "M ops/s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+long long checkSum(const vector<int> &ans, int cnt) {
+  long long ret = cnt;
+  for (auto &&a : ans) ret = 31 * ret + a;
+  return ret;
+}
+
+void test1() {
+  run(1, "UnionFind", [&] {
+    UnionFind uf(N);
+    vector<int> ans(Q);
+    for (int i = 0; i < Q; i++) {
+      if (i % 2 == 0) ans[i] = uf.join(edges[i].first, edges[i].second);
+      else ans[i] = uf.connected(edges[i].first, edges[i].second);
+    }
+    return checkSum(ans, uf.cnt);
+  });
+}
+
+void test2() {
+  run(2, "UnionFindConcurrent, 1 thread", [&] {
+    UnionFindConcurrent uf(N);
+    vector<int> ans(Q);
+    for (int i = 0; i < Q; i++) {
+      if (i % 2 == 0) ans[i] = uf.join(edges[i].first, edges[i].second);
+      else ans[i] = uf.connected(edges[i].first, edges[i].second);
+    }
+    return checkSum(ans, uf.getCnt());
+  });
+}
+
+void test3() {
+  ThreadPool::global().setThreads(4);
+  run(3, "UnionFindConcurrent, 4 threads", [&] {
+    UnionFindConcurrent uf(N);
+    vector<int> ans(Q);
+    ThreadPool::global().forRange(0, Q, [&] (int lo, int hi) {
+      for (int i = lo; i < hi; i++) {
+        if (i % 2 == 0) ans[i] = uf.join(edges[i].first, edges[i].second);
+        else ans[i] = uf.connected(edges[i].first, edges[i].second);
+      }
+    });
+    long long ret = uf.getCnt();
+    for (int v = 0; v < N; v++) ret = 31 * ret + uf.find(v);
+    return ret;
+  });
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+}
+
+void test4() {
+  run(4, "UnionFindConcurrent, 4 producer threads", [&] {
+    UnionFindConcurrent uf(N);
+    vector<thread> producers;
+    for (int t = 0; t < 4; t++) producers.emplace_back([&, t] {
+      for (int i = t; i < Q; i += 4) uf.join(edges[i].first, edges[i].second);
+    });
+    for (auto &&p : producers) p.join();
+    long long ret = uf.getCnt();
+    for (int v = 0; v < N; v++) ret = 31 * ret + uf.find(v);
+    return ret;
+  });
+}
+
+int main() {
+  gen();
+  test1();
+  test2();
+  test3();
+  test4();
+  cout << "Test Passed" << endl;
+  return 0;
+}
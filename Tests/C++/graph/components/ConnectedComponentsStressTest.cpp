@@ -1,5 +1,6 @@
 #include <bits/stdc++.h>
 #include "../../../../Content/C++/graph/components/ConnectedComponents.h"
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
 using namespace std;
 
 void test1() {
@@ -24,8 +25,110 @@ void test1() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+void test2() {
+  mt19937_64 rng(0);
+  int V = 2e6, E = 4e6;
+  StaticGraph G(V);
+  G.reserveDiEdges(E * 2);
+  for (int i = 0; i < E; i++) {
+    int c = rng() % 100;
+    int v = rng() % (V / 100) + (V / 100) * c, w = rng() % (V / 100) + (V / 100) * c;
+    G.addBiEdge(v, w);
+  }
+  G.build();
+  const auto start_time = chrono::system_clock::now();
+  AfforestCC<> cc(G);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Afforest) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (int v = 0; v < V; v++) checkSum = 31 * checkSum + cc.id[v];
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  mt19937_64 rng(0);
+  int V = 2e6, E = 4e6;
+  StaticGraph G(V);
+  G.reserveDiEdges(E * 2);
+  for (int i = 0; i < E; i++) {
+    int c = rng() % 100;
+    int v = rng() % (V / 100) + (V / 100) * c, w = rng() % (V / 100) + (V / 100) * c;
+    G.addBiEdge(v, w);
+  }
+  G.build();
+  ThreadPool::global().setThreads(4);
+  const auto start_time = chrono::system_clock::now();
+  AfforestCC<ParallelPolicy> cc(G);
+  const auto end_time = chrono::system_clock::now();
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (Parallel Afforest) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (int v = 0; v < V; v++) checkSum = 31 * checkSum + cc.id[v];
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test4() {
+  mt19937_64 rng(0);
+  int V = 2e6, E = 1e7;
+  StaticGraph G(V);
+  G.reserveDiEdges(E * 2);
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = rng() % V;
+    G.addBiEdge(v, w);
+  }
+  G.build();
+  const auto start_time = chrono::system_clock::now();
+  AfforestCC<> cc(G);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 4 (Afforest Giant Component) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (int v = 0; v < V; v++) checkSum = 31 * checkSum + cc.id[v];
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test5() {
+  mt19937_64 rng(0);
+  int V = 2e6, E = 1e7;
+  StaticGraph G(V);
+  G.reserveDiEdges(E * 2);
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = rng() % V;
+    G.addBiEdge(v, w);
+  }
+  G.build();
+  ThreadPool::global().setThreads(4);
+  const auto start_time = chrono::system_clock::now();
+  AfforestCC<ParallelPolicy> cc(G);
+  const auto end_time = chrono::system_clock::now();
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 5 (Parallel Afforest Giant Component) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (int v = 0; v < V; v++) checkSum = 31 * checkSum + cc.id[v];
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
+  test2();
+  test3();
+  test4();
+  test5();
   cout << "Test Passed" << endl;
   return 0;
 }
@@ -0,0 +1,89 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/components/ConnectedComponents.h"
+#include "../../../../Content/C++/graph/components/StronglyConnectedComponents.h"
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+using namespace std;
+
+vector<int> canonical(const vector<int> &id) {
+  vector<int> ret(id.size()), first(id.size(), -1);
+  for (int v = 0, k = 0; v < int(id.size()); v++) {
+    if (first[id[v]] == -1) first[id[v]] = k++;
+    ret[v] = first[id[v]];
+  }
+  return ret;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 3000;
+  long long checkSum = 0;
+  ThreadPool::global().setThreads(4);
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % (ti % 50 == 0 ? 100000 : 100);
+    int E = rng() % (V * (ti % 2 == 0 ? 1 : 3) + 1);
+    StaticGraph G(V);
+    G.reserveDiEdges(E * 2);
+    CC cc(V);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      G.addBiEdge(v, w);
+      cc.addEdge(v, w);
+    }
+    G.build();
+    cc.assign();
+    AfforestCC<> A(G);
+    AfforestCC<ParallelPolicy> B(G);
+    assert(A.id == B.id && A.components == B.components);
+    assert(A.id == canonical(cc.id));
+    assert(A.components.size() == cc.components.size());
+    for (int v = 0; v < V; v++) checkSum = 31 * checkSum + A.id[v];
+  }
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (Afforest) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 3000;
+  long long checkSum = 0;
+  ThreadPool::global().setThreads(4);
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % (ti % 50 == 0 ? 100000 : 100);
+    int E = rng() % (V * (ti % 2 == 0 ? 1 : 3) + 1), K = 1 + rng() % 10;
+    StaticGraph G(V);
+    G.reserveDiEdges(E);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      if (ti % 3 == 0) w = min(V - 1, v + int(rng() % K));
+      else if (ti % 3 == 1 && rng() % 4 != 0 && v < w) swap(v, w);
+      G.addDiEdge(v, w);
+    }
+    G.build();
+    SCC scc(G);
+    ParallelSCC<> A(G);
+    ParallelSCC<ParallelPolicy> B(G);
+    assert(A.id == B.id && A.components == B.components);
+    assert(A.id == canonical(scc.id));
+    assert(A.components.size() == scc.components.size());
+    for (int v = 0; v < V; v++) checkSum = 31 * checkSum + A.id[v];
+  }
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Parallel SCC) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
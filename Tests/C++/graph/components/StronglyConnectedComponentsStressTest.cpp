@@ -33,8 +33,86 @@ void test1() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+void test2() {
+  mt19937_64 rng(0);
+  int V = 2e6, E = 4e6;
+  StaticGraph G(V);
+  G.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) {
+    int c = rng() % 100;
+    int v = rng() % (V / 100) + (V / 100) * c, w = rng() % (V / 100) + (V / 100) * c;
+    G.addDiEdge(v, w);
+  }
+  G.build();
+  const auto start_time = chrono::system_clock::now();
+  ParallelSCC<> scc(G);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Parallel SCC on One Thread) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (int v = 0; v < V; v++) checkSum = 31 * checkSum + scc.id[v];
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  mt19937_64 rng(0);
+  int V = 2e6, E = 4e6;
+  StaticGraph G(V);
+  G.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) {
+    int c = rng() % 100;
+    int v = rng() % (V / 100) + (V / 100) * c, w = rng() % (V / 100) + (V / 100) * c;
+    G.addDiEdge(v, w);
+  }
+  G.build();
+  ThreadPool::global().setThreads(4);
+  const auto start_time = chrono::system_clock::now();
+  ParallelSCC<ParallelPolicy> scc(G);
+  const auto end_time = chrono::system_clock::now();
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (Parallel SCC) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (int v = 0; v < V; v++) checkSum = 31 * checkSum + scc.id[v];
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test4() {
+  mt19937_64 rng(0);
+  int V = 2e6, E = 8e6;
+  StaticGraph G(V);
+  G.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = rng() % V;
+    G.addDiEdge(v, w);
+  }
+  G.build();
+  ThreadPool::global().setThreads(4);
+  const auto start_time = chrono::system_clock::now();
+  ParallelSCC<ParallelPolicy> scc(G);
+  const auto end_time = chrono::system_clock::now();
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 4 (Parallel SCC Giant Component) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (int v = 0; v < V; v++) checkSum = 31 * checkSum + scc.id[v];
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
+  test2();
+  test3();
+  test4();
   cout << "Test Passed" << endl;
   return 0;
 }
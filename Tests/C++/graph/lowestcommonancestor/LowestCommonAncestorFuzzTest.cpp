@@ -0,0 +1,122 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/lowestcommonancestor/LowestCommonAncestor.h"
+#include "../../../../Content/C++/graph/lowestcommonancestor/TarjanOfflineLCA.h"
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+using namespace std;
+
+struct Forest {
+  int V;
+  vector<int> par, dep, roots;
+  vector<long long> wdep;
+  vector<pair<int, int>> edges;
+  vector<long long> weights;
+};
+
+Forest randomForest(mt19937_64 &rng, int V) {
+  Forest F;
+  F.V = V;
+  F.par.assign(V, -1);
+  F.dep.assign(V, 0);
+  F.wdep.assign(V, 0);
+  vector<int> P(V);
+  iota(P.begin(), P.end(), 0);
+  shuffle(P.begin(), P.end(), rng);
+  bool path = rng() % 4 == 0;
+  for (int i = 0; i < V; i++) {
+    int v = P[i];
+    if (i == 0 || rng() % 20 == 0) {
+      F.roots.push_back(v);
+      continue;
+    }
+    int p = path ? P[i - 1] : P[rng() % i];
+    long long w = rng() % 100;
+    F.par[v] = p;
+    F.dep[v] = F.dep[p] + 1;
+    F.wdep[v] = F.wdep[p] + w;
+    F.edges.emplace_back(v, p);
+    F.weights.push_back(w);
+  }
+  shuffle(F.roots.begin(), F.roots.end(), rng);
+  return F;
+}
+
+int naive(const Forest &F, int v, int w) {
+  while (F.dep[v] > F.dep[w]) v = F.par[v];
+  while (F.dep[w] > F.dep[v]) w = F.par[w];
+  while (v != w) {
+    if (v == -1 || w == -1) return -1;
+    v = F.par[v];
+    w = F.par[w];
+  }
+  return v;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 3000;
+  long long checkSum = 0;
+  ThreadPool::global().setThreads(4);
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % (ti % 10 == 0 ? 20000 : 100), Q = rng() % (V * 5 + 1);
+    Forest F = randomForest(rng, V);
+    vector<vector<int>> G(V);
+    vector<vector<pair<int, long long>>> WG(V);
+    StaticGraph SG(V);
+    for (int i = 0; i < int(F.edges.size()); i++) {
+      int v = F.edges[i].first, w = F.edges[i].second;
+      G[v].push_back(w);
+      G[w].push_back(v);
+      WG[v].emplace_back(w, F.weights[i]);
+      WG[w].emplace_back(v, F.weights[i]);
+      SG.addBiEdge(v, w);
+    }
+    SG.build();
+    vector<pair<int, int>> queries, connectedQueries;
+    for (int i = 0; i < Q; i++) {
+      int v = rng() % V, w = rng() % 5 == 0 ? v : rng() % V;
+      queries.emplace_back(v, w);
+      if (naive(F, v, w) != -1) connectedQueries.emplace_back(v, w);
+    }
+    LCA<> lca0(G, F.roots);
+    LCA<long long> lca1(WG, F.roots);
+    LCA<> lca2(SG, F.roots);
+    TarjanOfflineLCA tarjan0(G, queries, F.roots);
+    TarjanOfflineLCA tarjan1(WG, queries, F.roots);
+    TarjanOfflineLCA tarjan2(SG, queries, F.roots);
+    for (int v = 0; v < V; v++) assert(lca0.dep[v] == F.dep[v] && lca1.dep[v] == F.wdep[v]);
+    for (int i = 0; i < Q; i++) {
+      int v = queries[i].first, w = queries[i].second, ans = naive(F, v, w);
+      assert(tarjan0.ans[i] == ans);
+      assert(tarjan1.ans[i] == ans);
+      assert(tarjan2.ans[i] == ans);
+      assert(lca0.connected(v, w) == (ans != -1));
+      if (ans != -1) {
+        assert(lca0.lca(v, w) == ans);
+        assert(lca1.lca(v, w) == ans);
+        assert(lca2.lca(v, w) == ans);
+        assert(lca1.dist(v, w) == F.wdep[v] + F.wdep[w] - 2 * F.wdep[ans]);
+      }
+      checkSum = 31 * checkSum + ans;
+    }
+    vector<int> ans0 = lca0.lca(connectedQueries);
+    vector<int> ans1 = lca1.lca<ParallelPolicy>(connectedQueries);
+    for (int i = 0; i < int(connectedQueries.size()); i++) {
+      int ans = naive(F, connectedQueries[i].first, connectedQueries[i].second);
+      assert(ans0[i] == ans);
+      assert(ans1[i] == ans);
+    }
+  }
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  cout << "Test Passed" << endl;
+  return 0;
+}
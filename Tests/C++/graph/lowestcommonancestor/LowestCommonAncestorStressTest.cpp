@@ -0,0 +1,70 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/lowestcommonancestor/LowestCommonAncestor.h"
+#include "../../../../Content/C++/graph/lowestcommonancestor/TarjanOfflineLCA.h"
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+using namespace std;
+
+StaticGraph randomTree(mt19937_64 &rng, int V, bool path) {
+  vector<int> P(V);
+  iota(P.begin(), P.end(), 0);
+  shuffle(P.begin(), P.end(), rng);
+  StaticGraph G(V);
+  G.reserveDiEdges((V - 1) * 2);
+  for (int i = 1; i < V; i++) G.addBiEdge(P[i], path ? P[i - 1] : P[rng() % i]);
+  G.build();
+  return G;
+}
+
+void test(int subtest, const string &name, bool path) {
+  mt19937_64 rng(0);
+  const int V = 1e6, Q = 4e6;
+  StaticGraph G = randomTree(rng, V, path);
+  vector<pair<int, int>> queries;
+  for (int i = 0; i < Q; i++) queries.emplace_back(rng() % V, rng() % V);
+  auto start_time = chrono::system_clock::now();
+  LCA<> lca(G, 0);
+  auto end_time = chrono::system_clock::now();
+  double buildSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  long long checkSum0 = 0;
+  for (auto &&q : queries) checkSum0 = 31 * checkSum0 + lca.lca(q.first, q.second);
+  end_time = chrono::system_clock::now();
+  double singleSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  vector<int> ans0 = lca.lca(queries);
+  end_time = chrono::system_clock::now();
+  double batchSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  ThreadPool::global().setThreads(4);
+  start_time = chrono::system_clock::now();
+  vector<int> ans1 = lca.lca<ParallelPolicy>(queries);
+  end_time = chrono::system_clock::now();
+  double parallelSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  start_time = chrono::system_clock::now();
+  TarjanOfflineLCA tarjan(G, queries, 0);
+  end_time = chrono::system_clock::now();
+  double tarjanSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  long long checkSum1 = 0, checkSum2 = 0, checkSum3 = 0;
+  for (int i = 0; i < Q; i++) {
+    checkSum1 = 31 * checkSum1 + ans0[i];
+    checkSum2 = 31 * checkSum2 + ans1[i];
+    checkSum3 = 31 * checkSum3 + tarjan.ans[i];
+  }
+  assert(checkSum0 == checkSum1);
+  assert(checkSum0 == checkSum2);
+  assert(checkSum0 == checkSum3);
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  Build Time: " << fixed << setprecision(3) << buildSec << "s" << endl;
+  cout << "  Single Query Time: " << fixed << setprecision(3) << singleSec << "s" << endl;
+  cout << "  Batch Serial Time: " << fixed << setprecision(3) << batchSec << "s" << endl;
+  cout << "  Batch Parallel Time: " << fixed << setprecision(3) << parallelSec << "s" << endl;
+  cout << "  Tarjan Offline Time: " << fixed << setprecision(3) << tarjanSec << "s" << endl;
+  cout << "  Checksum: " << checkSum0 << endl;
+}
+
+int main() {
+  test(1, "Random Tree", false);
+  test(2, "Path", true);
+  cout << "Test Passed" << endl;
+  return 0;
+}
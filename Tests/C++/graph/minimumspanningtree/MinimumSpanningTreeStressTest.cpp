@@ -1,6 +1,8 @@
 #include <bits/stdc++.h>
 #include "../../../../Content/C++/graph/minimumspanningtree/BoruvkaMST.h"
+#include "../../../../Content/C++/graph/minimumspanningtree/FilterKruskalMST.h"
 #include "../../../../Content/C++/graph/minimumspanningtree/KruskalMST.h"
+#include "../../../../Content/C++/graph/minimumspanningtree/ParallelBoruvkaMST.h"
 #include "../../../../Content/C++/graph/minimumspanningtree/PrimMST.h"
 #include "../../../../Content/C++/graph/representations/StaticGraph.h"
 using namespace std;
@@ -207,6 +209,35 @@ void test7() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+template <class MST> void testSoA(int subtest, const string &name, int V, int E) {
+  mt19937_64 rng(0);
+  vector<int> A(E), B(E);
+  vector<long long> W(E);
+  for (int i = 0; i < E; i++) {
+    A[i] = rng() % V;
+    B[i] = rng() % V;
+    W[i] = rng() % (long long)(1e9) + 1;
+  }
+  const auto start_time = chrono::system_clock::now();
+  MST mst(V, A, B, W);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = mst.mstWeight;
+  vector<tuple<int, int, long long>> mstEdges;
+  for (int e : mst.mstEdges) mstEdges.emplace_back(min(A[e], B[e]), max(A[e], B[e]), W[e]);
+  sort(mstEdges.begin(), mstEdges.end());
+  for (auto &&e : mstEdges) {
+    checkSum = 31 * checkSum + get<0>(e);
+    checkSum = 31 * checkSum + get<1>(e);
+    checkSum = 31 * checkSum + get<2>(e);
+  }
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
   test2();
@@ -215,6 +246,16 @@ int main() {
   test5();
   test6();
   test7();
+  testSoA<FilterKruskalMST<long long>>(8, "Filter Kruskal", 1e4, 1e6);
+  testSoA<FilterKruskalMST<long long>>(9, "Filter Kruskal", 2e5, 1e6);
+  testSoA<ParallelBoruvkaMST<long long>>(10, "Parallel Boruvka, serial", 1e4, 1e6);
+  testSoA<ParallelBoruvkaMST<long long>>(11, "Parallel Boruvka, serial", 2e5, 1e6);
+  ThreadPool::global().setThreads(4);
+  testSoA<FilterKruskalMST<long long, ParallelPolicy>>(12, "Filter Kruskal, 4 threads", 1e4, 1e6);
+  testSoA<FilterKruskalMST<long long, ParallelPolicy>>(13, "Filter Kruskal, 4 threads", 2e5, 1e6);
+  testSoA<ParallelBoruvkaMST<long long, ParallelPolicy>>(14, "Parallel Boruvka, 4 threads", 1e4, 1e6);
+  testSoA<ParallelBoruvkaMST<long long, ParallelPolicy>>(15, "Parallel Boruvka, 4 threads", 2e5, 1e6);
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
   cout << "Test Passed" << endl;
   return 0;
 }
@@ -0,0 +1,102 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/minimumspanningtree/FilterKruskalMST.h"
+#include "../../../../Content/C++/graph/minimumspanningtree/KruskalMST.h"
+#include "../../../../Content/C++/graph/minimumspanningtree/ParallelBoruvkaMST.h"
+using namespace std;
+
+vector<int> reference(int V, const vector<int> &A, const vector<int> &B, const vector<long long> &W) {
+  vector<int> ord(A.size()), ret;
+  iota(ord.begin(), ord.end(), 0);
+  sort(ord.begin(), ord.end(), [&] (int e, int f) {
+    return make_pair(W[e], e) < make_pair(W[f], f);
+  });
+  UnionFind uf(V);
+  for (int e : ord) if (uf.join(A[e], B[e])) ret.push_back(e);
+  sort(ret.begin(), ret.end());
+  return ret;
+}
+
+template <class MST> long long check(const MST &mst, const vector<int> &ref, const vector<long long> &W) {
+  vector<int> edges = mst.mstEdges;
+  sort(edges.begin(), edges.end());
+  assert(edges == ref);
+  long long weight = 0;
+  for (int e : ref) weight += W[e];
+  assert(mst.mstWeight == weight);
+  return weight;
+}
+
+template <class Policy> void test(int subtest, const string &name) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 3000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % (ti % 10 == 0 ? 2000 : 100);
+    int E = rng() % (ti % 3 == 0 ? V * 20 + 1 : V * 2 + 1);
+    long long MAXW = ti % 2 == 0 ? 5 : 1e9;
+    vector<int> A(E), B(E);
+    vector<long long> W(E);
+    vector<KruskalMST<long long>::Edge> edges;
+    for (int i = 0; i < E; i++) {
+      A[i] = rng() % V;
+      B[i] = rng() % V;
+      W[i] = rng() % MAXW;
+      edges.emplace_back(A[i], B[i], W[i]);
+    }
+    vector<int> ref = reference(V, A, B, W);
+    KruskalMST<long long> mst0(V, edges);
+    FilterKruskalMST<long long, Policy> mst1(V, A, B, W);
+    ParallelBoruvkaMST<long long, Policy> mst2(V, A, B, W);
+    long long weight = check(mst1, ref, W);
+    assert(check(mst2, ref, W) == weight);
+    assert(mst0.mstWeight == weight);
+    for (int i = 0; i + 1 < int(mst1.mstEdges.size()); i++) {
+      int e = mst1.mstEdges[i], f = mst1.mstEdges[i + 1];
+      assert(make_pair(W[e], e) < make_pair(W[f], f));
+    }
+    checkSum = 31 * checkSum + weight;
+    for (int e : ref) checkSum = 31 * checkSum + e;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+template <class Policy> void testPartition(int subtest, const string &name) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 3000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % (ti % 10 == 0 ? 100000 : 100), l = rng() % (N + 1), r = l + rng() % (N - l + 1);
+    int grain = 1 + rng() % 100, MOD = 1 + rng() % 5;
+    vector<int> A(N), tmp(N);
+    for (auto &&a : A) a = rng() % 1000;
+    vector<int> B = A;
+    auto pred = [&] (int a) { return a % MOD == 0; };
+    stable_partition(B.begin() + l, B.begin() + r, pred);
+    int m = stablePartition<Policy>(A, l, r, tmp, pred, grain);
+    assert(A == B);
+    assert(m == int(partition_point(B.begin() + l, B.begin() + r, pred) - B.begin()));
+    checkSum = 31 * checkSum + m;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test<SerialPolicy>(1, "Serial");
+  testPartition<SerialPolicy>(2, "Stable Partition, Serial");
+  ThreadPool::global().setThreads(4);
+  test<ParallelPolicy>(3, "Parallel");
+  testPartition<ParallelPolicy>(4, "Stable Partition, Parallel");
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  cout << "Test Passed" << endl;
+  return 0;
+}
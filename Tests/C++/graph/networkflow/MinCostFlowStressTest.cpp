@@ -0,0 +1,136 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/networkflow/NetworkSimplexMinCostFlow.h"
+#include "../../../../Content/C++/graph/networkflow/PushRelabelMinCostMaxFlow.h"
+#include "../../../../Content/C++/graph/networkflow/SAPMinCostMaxFlow.h"
+using namespace std;
+
+template <class T> size_t bytes(const vector<T> &a) { return a.capacity() * sizeof(T); }
+template <class T> size_t bytes(const vector<vector<T>> &a) {
+  size_t ret = a.capacity() * sizeof(vector<T>);
+  for (auto &&b : a) ret += bytes(b);
+  return ret;
+}
+
+template <class F, class C> size_t bytes(const NetworkSimplexMinCostFlow<F, C> &mcf) {
+  return bytes(mcf.A) + bytes(mcf.B) + bytes(mcf.par) + bytes(mcf.pe) + bytes(mcf.dep) + bytes(mcf.fch) + bytes(mcf.nsb) + bytes(mcf.psb)
+      + bytes(mcf.stk) + bytes(mcf.CAP) + bytes(mcf.FLOW) + bytes(mcf.COST) + bytes(mcf.pi) + bytes(mcf.state);
+}
+
+template <class F, class C> size_t bytes(const PushRelabelMinCostMaxFlow<F, C> &mcf) {
+  return bytes(mcf.cnt) + bytes(mcf.h) + bytes(mcf.stk) + bytes(mcf.ex) + bytes(mcf.phi) + bytes(mcf.hs) + bytes(mcf.adj) + bytes(mcf.cur)
+      + bytes(mcf.pos) + bytes(mcf.loops);
+}
+
+template <class F, class C> size_t bytes(const SAPMinCostMaxFlow<F, C> &mcf) {
+  return bytes(mcf.prev) + bytes(mcf.to) + bytes(mcf.phi) + bytes(mcf.dist) + bytes(mcf.adj) + bytes(mcf.ptr) + bytes(mcf.pos);
+}
+
+struct Instance {
+  string name;
+  int V, s, t;
+  vector<tuple<int, int, long long, long long>> edges;
+};
+
+Instance grid(mt19937_64 &rng, int R, int C) {
+  Instance I;
+  I.name = "Grid";
+  I.V = R * C;
+  I.s = 0;
+  I.t = R * C - 1;
+  for (int i = 0; i < R; i++) for (int j = 0; j < C; j++) {
+    int v = i * C + j;
+    if (j + 1 < C) {
+      I.edges.emplace_back(v, v + 1, rng() % 100 + 1, rng() % 100 + 1);
+      I.edges.emplace_back(v + 1, v, rng() % 100 + 1, rng() % 100 + 1);
+    }
+    if (i + 1 < R) {
+      I.edges.emplace_back(v, v + C, rng() % 100 + 1, rng() % 100 + 1);
+      I.edges.emplace_back(v + C, v, rng() % 100 + 1, rng() % 100 + 1);
+    }
+  }
+  return I;
+}
+
+Instance randomGraph(mt19937_64 &rng, int V, int E) {
+  Instance I;
+  I.name = "Random";
+  I.V = V;
+  I.s = 0;
+  I.t = V - 1;
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = rng() % V;
+    I.edges.emplace_back(v, w, rng() % 1000 + 1, rng() % 1000 + 1);
+  }
+  return I;
+}
+
+Instance assignment(mt19937_64 &rng, int N, int K) {
+  Instance I;
+  I.name = "Assignment";
+  I.V = N * 2 + 2;
+  I.s = N * 2;
+  I.t = N * 2 + 1;
+  for (int i = 0; i < N; i++) {
+    I.edges.emplace_back(I.s, i, 1, 0);
+    I.edges.emplace_back(N + i, I.t, 1, 0);
+    for (int k = 0; k < K; k++) I.edges.emplace_back(i, N + rng() % N, 1, rng() % 10000 + 1);
+  }
+  return I;
+}
+
+struct Result {
+  long long flow, cost, count;
+  size_t bytes;
+};
+
+template <class F> Result run(int subtest, const string &engine, const string &counter, const Instance &I, F f) {
+  const auto start_time = chrono::system_clock::now();
+  Result r = f();
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  double mb = r.bytes / double(1 << 20);
+  cout << "Subtest " << subtest << " (" << I.name << ", " << engine << ") Passed" << endl;
+  cout << "  V: " << I.V << endl;
+  cout << "  E: " << I.edges.size() << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  " << counter << ": " << r.count << endl;
+  cout << "  Retained Memory: " << fixed << setprecision(3) << mb << "MB" << endl;
+  cout << "  Checksum: " << 31 * r.flow + r.cost << endl;
+  return r;
+}
+
+void test(int &subtest, const Instance &I) {
+  Result r0 = run(subtest++, "NetworkSimplexMinCostFlow", "Pivots", I, [&] {
+    NetworkSimplexMinCostFlow<long long, long long> mcf(I.V);
+    mcf.reserveEdges(I.edges.size());
+    for (auto &&e : I.edges) mcf.addEdge(get<0>(e), get<1>(e), get<2>(e), get<3>(e));
+    pair<long long, long long> r = mcf.getMaxFlowMinCost(I.s, I.t);
+    return Result{r.first, r.second, mcf.pivots, bytes(mcf)};
+  });
+  Result r1 = run(subtest++, "PushRelabelMinCostMaxFlow", "Pushes", I, [&] {
+    PushRelabelMinCostMaxFlow<long long, long long> mcf(I.V, 0, 1e15, 0);
+    mcf.reserveEdges(I.edges.size());
+    for (auto &&e : I.edges) mcf.addEdge(get<0>(e), get<1>(e), get<2>(e), get<3>(e));
+    pair<long long, long long> r = mcf.getMaxFlowMinCost(I.s, I.t);
+    return Result{r.first, r.second, mcf.pushes, bytes(mcf)};
+  });
+  Result r2 = run(subtest++, "SAPMinCostMaxFlow", "Augmenting Paths", I, [&] {
+    SAPMinCostMaxFlow<long long, long long> mcf(I.V, LLONG_MAX, 0, LLONG_MAX);
+    mcf.reserveEdges(I.edges.size());
+    for (auto &&e : I.edges) mcf.addEdge(get<0>(e), get<1>(e), get<2>(e), get<3>(e));
+    pair<long long, long long> r = mcf.getMaxFlowMinCost(I.s, I.t);
+    return Result{r.first, r.second, mcf.augments, bytes(mcf)};
+  });
+  assert(r0.flow == r1.flow && r0.cost == r1.cost);
+  assert(r0.flow == r2.flow && r0.cost == r2.cost);
+}
+
+int main() {
+  mt19937_64 rng(0);
+  int subtest = 1;
+  test(subtest, grid(rng, 100, 100));
+  test(subtest, randomGraph(rng, 10000, 100000));
+  test(subtest, assignment(rng, 2000, 20));
+  cout << "Test Passed" << endl;
+  return 0;
+}
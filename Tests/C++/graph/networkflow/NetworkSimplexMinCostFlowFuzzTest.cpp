@@ -0,0 +1,135 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/networkflow/NetworkSimplexMinCostFlow.h"
+#include "../../../../Content/C++/graph/networkflow/PushRelabelMinCostMaxFlow.h"
+#include "../../../../Content/C++/graph/networkflow/SAPMinCostMaxFlow.h"
+using namespace std;
+
+template <class MCF> void checkEdges(const MCF &mcf, int V, const vector<tuple<int, int, long long, long long>> &edges, const vector<long long> &supply, long long cost) {
+  vector<long long> net(V, 0);
+  long long total = 0;
+  for (int i = 0; i < int(edges.size()); i++) {
+    long long f = mcf.getEdgeFlow(i);
+    assert(0 <= f && f <= get<2>(edges[i]));
+    net[get<0>(edges[i])] += f;
+    net[get<1>(edges[i])] -= f;
+    total += f * get<3>(edges[i]);
+  }
+  for (int v = 0; v < V; v++) assert(net[v] == supply[v]);
+  assert(total == cost);
+}
+
+void check(NetworkSimplexMinCostFlow<long long, long long> &mcf, const vector<long long> &supply, long long cost) {
+  vector<long long> net(mcf.V, 0);
+  long long total = 0;
+  for (int i = 0; i < mcf.E; i++) {
+    long long f = mcf.getEdgeFlow(i), c = mcf.reduced(i);
+    assert(0 <= f && f <= mcf.CAP[i]);
+    if (f < mcf.CAP[i]) assert(c >= 0);
+    if (f > 0) assert(c <= 0);
+    net[mcf.A[i]] += f;
+    net[mcf.B[i]] -= f;
+    total += f * mcf.COST[i];
+  }
+  for (int v = 0; v < mcf.V; v++) assert(net[v] == supply[v]);
+  assert(total == cost);
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 10000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 2 + rng() % 100, E = rng() % (V * 5 + 1);
+    int s = rng() % V, t = rng() % V;
+    if (ti % 10 == 0) t = s;
+    bool neg = ti % 2 == 0;
+    long long MAXCAP = ti % 3 == 0 ? 5 : 1e6, MAXCOST = ti % 3 == 1 ? 5 : 1e6;
+    NetworkSimplexMinCostFlow<long long, long long> mcf(V);
+    PushRelabelMinCostMaxFlow<long long, long long> mcf0(V, 0, 1e15, 0);
+    SAPMinCostMaxFlow<long long, long long> mcf1(V, LLONG_MAX, 0, LLONG_MAX);
+    vector<tuple<int, int, long long, long long>> edges;
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      long long cap = rng() % (MAXCAP + 1), cost = rng() % (MAXCOST + 1);
+      if (neg) cost -= MAXCOST / 2;
+      edges.emplace_back(v, w, cap, cost);
+      assert(mcf.addEdge(v, w, cap, cost) == i);
+      assert(mcf0.addEdge(v, w, cap, cost) == i);
+      if (!neg) assert(mcf1.addEdge(v, w, cap, cost) == i);
+    }
+    pair<long long, long long> r = mcf.getMaxFlowMinCost(s, t);
+    assert(r == mcf0.getMaxFlowMinCost(s, t));
+    vector<long long> supply(V, 0);
+    supply[s] += r.first;
+    supply[t] -= r.first;
+    check(mcf, supply, r.second);
+    checkEdges(mcf0, V, edges, supply, r.second);
+    if (!neg && s != t) {
+      assert(r == mcf1.getMaxFlowMinCost(s, t));
+      checkEdges(mcf1, V, edges, supply, r.second);
+    }
+    checkSum = 31 * checkSum + r.first;
+    checkSum = 31 * checkSum + r.second;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (Max Flow Min Cost) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 10000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % 100, E = rng() % (V * 5 + 1);
+    NetworkSimplexMinCostFlow<long long, long long> mcf(V);
+    PushRelabelMinCostMaxFlow<long long, long long> mcf0(V + 2, 0, 1e15, 0);
+    vector<long long> supply(V, 0);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      long long cap = rng() % 101, cost = (long long)(rng() % 201) - 100;
+      mcf.addEdge(v, w, cap, cost);
+      mcf0.addEdge(v, w, cap, cost);
+    }
+    long long need = 0;
+    for (int k = rng() % 5; k > 0; k--) {
+      int v = rng() % V, w = rng() % V;
+      long long d = rng() % 51;
+      supply[v] += d;
+      supply[w] -= d;
+    }
+    for (int v = 0; v < V; v++) {
+      if (supply[v] > 0) {
+        mcf0.addEdge(V, v, supply[v], 0);
+        need += supply[v];
+      } else if (supply[v] < 0) mcf0.addEdge(v, V + 1, -supply[v], 0);
+    }
+    pair<long long, long long> r0 = mcf0.getMaxFlowMinCost(V, V + 1);
+    for (int k = 0; k < 2; k++) {
+      pair<bool, long long> r = mcf.getMinCostFlow(supply);
+      assert(r.first == (r0.first == need));
+      if (r.first) {
+        assert(r.second == r0.second);
+        check(mcf, supply, r.second);
+      }
+      checkSum = 31 * checkSum + r.first;
+      checkSum = 31 * checkSum + r.second;
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Supplies) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
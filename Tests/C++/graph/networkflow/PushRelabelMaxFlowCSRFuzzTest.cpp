@@ -0,0 +1,155 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/networkflow/PushRelabelMaxFlow.h"
+#include "../../../../Content/C++/graph/networkflow/PushRelabelMaxFlowCSR.h"
+using namespace std;
+
+const int MAXV = 1005;
+PushRelabelMaxFlow<MAXV, long long> mf0(0);
+
+template <class Flow> void check(Flow &mf, const vector<tuple<int, int, long long, long long>> &edges, int V, int s, int t, long long flow) {
+  vector<long long> net(V, 0);
+  long long cutCap = 0;
+  for (int i = 0; i < int(edges.size()); i++) {
+    int v, w;
+    long long vw, wv;
+    tie(v, w, vw, wv) = edges[i];
+    long long f = mf.getEdgeFlow(i);
+    assert(-wv <= f && f <= vw);
+    net[v] -= f;
+    net[w] += f;
+    if (mf.cut[v] && !mf.cut[w]) cutCap += vw;
+    if (mf.cut[w] && !mf.cut[v]) cutCap += wv;
+  }
+  for (int v = 0; v < V; v++) {
+    if (v == s) assert(net[v] == -flow);
+    else if (v == t) assert(net[v] == flow);
+    else assert(net[v] == 0);
+  }
+  assert(mf.cut[s] && !mf.cut[t]);
+  assert(cutCap == flow);
+}
+
+template <class Policy> void test(int subtest, const string &name, int TESTCASES) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 2 + rng() % (ti % 10 == 0 ? 1000 : 50);
+    int E = rng() % (V * (ti % 3 == 0 ? 2 : 6) + 1);
+    long long MAXC = ti % 2 == 0 ? 10 : 1e9;
+    int s = rng() % V, t = rng() % V;
+    if (ti % 5 == 0) t = s;
+    vector<tuple<int, int, long long, long long>> edges;
+    mf0.init(V);
+    PushRelabelMaxFlowCSR<long long, Policy> mf(V);
+    mf.reserveEdges(E);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      long long vw = rng() % MAXC, wv = rng() % 3 == 0 ? rng() % MAXC : 0;
+      edges.emplace_back(v, w, vw, wv);
+      mf0.addEdge(v, w, vw, wv);
+      mf.addEdge(v, w, vw, wv);
+    }
+    long long f0 = mf0.getFlow(V, s, t);
+    for (int k = 0; k < 2; k++) {
+      long long f1 = mf.getFlow(s, t);
+      assert(f0 == f1);
+      if (s != t) check(mf, edges, V, s, t, f1);
+    }
+    checkSum = 31 * checkSum + f0;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 2 + rng() % 50, E = rng() % (V * 4 + 1);
+    int s = rng() % V, t = rng() % V;
+    mf0.init(V);
+    PushRelabelMaxFlowCSR<double> mf(V, 1e-9);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      double vw = double(rng() % 1000) / 7;
+      mf0.addEdge(v, w, llround(vw * 7));
+      mf.addEdge(v, w, vw);
+    }
+    long long f0 = mf0.getFlow(V, s, t);
+    double f1 = mf.getFlow(s, t);
+    assert(abs(f0 - f1 * 7) < 1e-6 * max(1LL, f0));
+    checkSum = 31 * checkSum + f0;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (Floating Point) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+template <class Policy> void testResolve(int subtest, const string &name, int TESTCASES) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 2 + rng() % (ti % 10 == 0 ? 1000 : 50);
+    int E = 1 + rng() % (V * (ti % 3 == 0 ? 2 : 6) + 1);
+    long long MAXC = ti % 2 == 0 ? 10 : 1e9;
+    int s = rng() % V, t = rng() % V;
+    vector<tuple<int, int, long long, long long>> edges;
+    PushRelabelMaxFlowCSR<long long, Policy> mf(V);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      if (rng() % 4 == 0) v = s;
+      if (rng() % 4 == 0) w = t;
+      long long vw = rng() % MAXC, wv = rng() % 3 == 0 ? rng() % MAXC : 0;
+      edges.emplace_back(v, w, vw, wv);
+      mf.addEdge(v, w, vw, wv);
+    }
+    mf.getFlow(s, t);
+    for (int round = 0; round < 10; round++) {
+      int K = 1 + rng() % (rng() % 2 == 0 ? 3 : E);
+      vector<tuple<int, long long, long long>> deltas;
+      for (int k = 0; k < K; k++) {
+        int i = rng() % E;
+        long long &vw = get<2>(edges[i]), &wv = get<3>(edges[i]);
+        long long dvw = (long long)(rng() % MAXC) - vw, dwv = rng() % 2 == 0 ? 0 : (long long)(rng() % MAXC) - wv;
+        vw += dvw;
+        wv += dwv;
+        deltas.emplace_back(i, dvw, dwv);
+      }
+      long long f1 = mf.resolve(deltas);
+      mf0.init(V);
+      for (auto &&e : edges) mf0.addEdge(get<0>(e), get<1>(e), get<2>(e), get<3>(e));
+      long long f0 = mf0.getFlow(V, s, t);
+      assert(f0 == f1);
+      if (s != t) check(mf, edges, V, s, t, f1);
+      checkSum = 31 * checkSum + f1;
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test<SerialPolicy>(1, "Serial", 10000);
+  ThreadPool::global().setThreads(4);
+  test<ParallelPolicy>(2, "Parallel", 10000);
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  test3();
+  testResolve<SerialPolicy>(4, "Resolve Serial", 3000);
+  ThreadPool::global().setThreads(4);
+  testResolve<ParallelPolicy>(5, "Resolve Parallel", 3000);
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,136 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/networkflow/PushRelabelMaxFlow.h"
+#include "../../../../Content/C++/graph/networkflow/PushRelabelMaxFlowCSR.h"
+using namespace std;
+
+const int MAXV = 1e5 + 5;
+PushRelabelMaxFlow<MAXV, long long> mf0(0);
+
+struct Instance {
+  int V, s, t;
+  vector<tuple<int, int, long long>> edges;
+};
+
+Instance layered(mt19937_64 &rng, int L, int W, int D) {
+  Instance I;
+  I.V = L * W + 2;
+  I.s = L * W;
+  I.t = L * W + 1;
+  for (int j = 0; j < W; j++) {
+    I.edges.emplace_back(I.s, j, rng() % 1000000 + 1);
+    I.edges.emplace_back((L - 1) * W + j, I.t, rng() % 1000000 + 1);
+  }
+  for (int i = 0; i + 1 < L; i++) for (int j = 0; j < W; j++) for (int k = 0; k < D; k++) {
+    int w = (i + 1) * W + (j + int(rng() % 21) - 10 + W) % W;
+    I.edges.emplace_back(i * W + j, w, rng() % 10000 + 1);
+  }
+  return I;
+}
+
+template <class F> void run(int subtest, const string &name, const Instance &I, F f) {
+  const auto start_time = chrono::system_clock::now();
+  long long flow = f();
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  V: " << I.V << endl;
+  cout << "  E: " << I.edges.size() << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << flow << endl;
+}
+
+template <class Policy> long long solveCSR(const Instance &I) {
+  PushRelabelMaxFlowCSR<long long, Policy> mf(I.V);
+  mf.reserveEdges(I.edges.size());
+  for (auto &&e : I.edges) mf.addEdge(get<0>(e), get<1>(e), get<2>(e));
+  return mf.getFlow(I.s, I.t);
+}
+
+void test1() {
+  mt19937_64 rng(0);
+  Instance I = layered(rng, 100, 500, 5);
+  run(1, "PushRelabelMaxFlow", I, [&] {
+    mf0.init(I.V);
+    for (auto &&e : I.edges) mf0.addEdge(get<0>(e), get<1>(e), get<2>(e));
+    return mf0.getFlow(I.V, I.s, I.t);
+  });
+  run(2, "PushRelabelMaxFlowCSR, serial", I, [&] { return solveCSR<SerialPolicy>(I); });
+  ThreadPool::global().setThreads(4);
+  run(3, "PushRelabelMaxFlowCSR, 4 threads", I, [&] { return solveCSR<ParallelPolicy>(I); });
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  int V = 1000, E = 10000, Q = 3e3;
+  PushRelabelMaxFlowCSR<long long> mf(V);
+  mf.reserveEdges(E);
+  for (int i = 0; i < E; i++) mf.addEdge(rng() % V, rng() % V, rng() % 1000 + 1);
+  long long checkSum = 0;
+  for (int i = 0; i < Q; i++) {
+    int s = rng() % V, t = rng() % V;
+    checkSum = 31 * checkSum + mf.getFlow(s, t);
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 4 (Repeated Flows) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Q: " << Q << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  mt19937_64 rng(0);
+  Instance I = layered(rng, 100, 500, 5);
+  int E = I.edges.size(), TICKS = 100, K = 5;
+  PushRelabelMaxFlowCSR<long long> mf(I.V), fresh(I.V);
+  for (auto &&e : I.edges) {
+    mf.addEdge(get<0>(e), get<1>(e), get<2>(e));
+    fresh.addEdge(get<0>(e), get<1>(e), get<2>(e));
+  }
+  mf.getFlow(I.s, I.t);
+  fresh.build();
+  double freshSec = 0;
+  long long checkSum = 0;
+  const auto start_time = chrono::system_clock::now();
+  for (int tick = 0; tick < TICKS; tick++) {
+    vector<tuple<int, long long, long long>> deltas;
+    for (int k = 0; k < K; k++) {
+      int i = rng() % E;
+      long long c = get<2>(I.edges[i]), d = (long long)(rng() % 20001) - 10000;
+      d = max(d, -c);
+      get<2>(I.edges[i]) += d;
+      deltas.emplace_back(i, d, 0);
+      fresh.CAP[fresh.pos[i]] += d;
+    }
+    long long flow = mf.resolve(deltas);
+    if (tick % 25 == 0) {
+      const auto fresh_start = chrono::system_clock::now();
+      assert(fresh.getFlow(I.s, I.t) == flow);
+      const auto fresh_end = chrono::system_clock::now();
+      freshSec += ((fresh_end - fresh_start).count() / double(chrono::system_clock::period::den));
+    }
+    checkSum = 31 * checkSum + flow;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den)) - freshSec;
+  cout << "Subtest 5 (Resolve After Capacity Changes) Passed" << endl;
+  cout << "  V: " << I.V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Ticks: " << TICKS << endl;
+  cout << "  Changes Per Tick: " << K << endl;
+  cout << "  Time Per Resolve: " << fixed << setprecision(6) << sec / TICKS << "s" << endl;
+  cout << "  Time Per Fresh Solve: " << fixed << setprecision(6) << freshSec / (TICKS / 25) << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
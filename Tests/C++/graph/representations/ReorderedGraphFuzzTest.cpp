@@ -0,0 +1,122 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/representations/ReorderedGraph.h"
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/search/BreadthFirstSearch.h"
+#include "../../../../Content/C++/graph/shortestpaths/DijkstraSSSP.h"
+using namespace std;
+
+bool isPermutation(vector<int> ord) {
+  sort(ord.begin(), ord.end());
+  for (int i = 0; i < int(ord.size()); i++) if (ord[i] != i) return false;
+  return true;
+}
+
+template <class Graph> int bandwidth(const Graph &G) {
+  int ret = 0;
+  for (int v = 0; v < G.size(); v++) for (int e = G.ST[v]; e < G.ST[v + 1]; e++) ret = max(ret, abs(v - G.TO[e]));
+  return ret;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 3000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % (ti % 100 == 0 ? 10000 : 100);
+    int E = rng() % (V * 3 + 1);
+    bool directed = ti % 2 == 1;
+    StaticWeightedGraph<long long> G(V);
+    G.reserveDiEdges(E * 2);
+    vector<tuple<int, int, long long>> edges;
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      long long weight = rng() % 100 + 1;
+      if (directed) {
+        G.addDiEdge(v, w, weight);
+        edges.emplace_back(v, w, weight);
+      } else {
+        G.addBiEdge(v, w, weight);
+        edges.emplace_back(v, w, weight);
+        edges.emplace_back(w, v, weight);
+      }
+    }
+    G.build();
+    vector<vector<int>> ords;
+    ords.push_back(degreeOrder(G));
+    ords.push_back(reverseCuthillMcKeeOrder(G));
+    ords.push_back(gorderOrder(G));
+    ords.push_back(gorderOrder(G, 1 + rng() % 10, rng() % 10));
+    int s = rng() % V;
+    DijkstraSSSP<long long> dijkstra0(G, s);
+    sort(edges.begin(), edges.end());
+    for (auto &&ord : ords) {
+      assert(int(ord.size()) == V);
+      assert(isPermutation(ord));
+      ReorderedGraph<StaticWeightedGraph<long long>> R(G, ord);
+      assert(R.ord == ord);
+      for (int v = 0; v < V; v++) assert(R.ind[R.ord[v]] == v);
+      vector<tuple<int, int, long long>> edges1;
+      for (int v = 0; v < V; v++) {
+        assert(R.G.ST[v + 1] - R.G.ST[v] == G.ST[R.ord[v] + 1] - G.ST[R.ord[v]]);
+        for (int e = R.G.ST[v]; e < R.G.ST[v + 1]; e++) {
+          if (e > R.G.ST[v]) assert(R.G.TO[e - 1] <= R.G.TO[e]);
+          edges1.emplace_back(R.ord[v], R.ord[R.G.TO[e]], R.G.WEIGHT[e]);
+        }
+      }
+      sort(edges1.begin(), edges1.end());
+      assert(edges == edges1);
+      DijkstraSSSP<long long> dijkstra1(R.G, R.ind[s]);
+      for (int v = 0; v < V; v++) assert(dijkstra0.dist[v] == dijkstra1.dist[R.ind[v]]);
+      for (int v = 0; v < V; v++) checkSum = 31 * checkSum + ord[v];
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (Weighted) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 300;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = 1 + rng() % 50, M = 1 + rng() % 50, V = N * M;
+    vector<int> P(V);
+    iota(P.begin(), P.end(), 0);
+    shuffle(P.begin(), P.end(), rng);
+    StaticGraph G(V);
+    for (int i = 0; i < N; i++) for (int j = 0; j < M; j++) {
+      if (i + 1 < N) G.addBiEdge(P[i * M + j], P[(i + 1) * M + j]);
+      if (j + 1 < M) G.addBiEdge(P[i * M + j], P[i * M + j + 1]);
+    }
+    G.build();
+    vector<int> ord = reverseCuthillMcKeeOrder(G);
+    assert(isPermutation(ord));
+    ReorderedGraph<StaticGraph> R(G, ord);
+    int bw = bandwidth(R.G);
+    assert(bw <= min(N, M) + 1);
+    int s = rng() % V;
+    BFS<> bfs0(G, s), bfs1(R.G, R.ind[s]);
+    for (int v = 0; v < V; v++) assert(bfs0.dist[v] == bfs1.dist[R.ind[v]]);
+    ReorderedGraph<StaticGraph> R2(G, gorderOrder(G));
+    BFS<> bfs2(R2.G, R2.ind[s]);
+    for (int v = 0; v < V; v++) assert(bfs0.dist[v] == bfs2.dist[R2.ind[v]]);
+    checkSum = 31 * checkSum + bw;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Grid Bandwidth) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
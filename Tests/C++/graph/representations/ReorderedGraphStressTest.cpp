@@ -0,0 +1,71 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/representations/ReorderedGraph.h"
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/search/BreadthFirstSearch.h"
+#include "../../../../Content/C++/graph/shortestpaths/DijkstraSSSP.h"
+using namespace std;
+
+const int N = 800, M = 800, V = N * M, SOURCES = 2;
+StaticGraph G0(V);
+StaticWeightedGraph<long long> G(V);
+
+void gen() {
+  mt19937_64 rng(0);
+  vector<int> P(V);
+  iota(P.begin(), P.end(), 0);
+  shuffle(P.begin(), P.end(), rng);
+  G0.reserveDiEdges(V * 5);
+  G.reserveDiEdges(V * 5);
+  auto addBiEdge = [&] (int v, int w, long long weight) {
+    G0.addBiEdge(v, w);
+    G.addBiEdge(v, w, weight);
+  };
+  for (int i = 0; i < N; i++) for (int j = 0; j < M; j++) {
+    int v = P[i * M + j];
+    if (i + 1 < N) addBiEdge(v, P[(i + 1) * M + j], rng() % 100 + 1);
+    if (j + 1 < M) addBiEdge(v, P[i * M + j + 1], rng() % 100 + 1);
+    if (rng() % 100 == 0) addBiEdge(v, P[rng() % V], rng() % 1000 + 1);
+  }
+  G0.build();
+  G.build();
+}
+
+void run(int subtest, const string &name, function<vector<int>()> order) {
+  auto start_time = chrono::system_clock::now();
+  vector<int> ord = order();
+  ReorderedGraph<StaticGraph> R0(G0, ord);
+  ReorderedGraph<StaticWeightedGraph<long long>> R(G, ord);
+  auto end_time = chrono::system_clock::now();
+  double reorderSec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  long long checkSum = 0;
+  for (int i = 0; i < SOURCES; i++) {
+    int s = R.ind[int(1LL * i * V / SOURCES)];
+    BFS<> bfs(R0.G, s);
+    DijkstraSSSP<long long> dijkstra(R.G, s);
+    for (int v = 0; v < V; v++) checkSum = 31 * checkSum + bfs.dist[R.ind[v]];
+    for (int v = 0; v < V; v++) checkSum = 31 * checkSum + dijkstra.dist[R.ind[v]];
+  }
+  end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << G.TO.size() << endl;
+  cout << "  Reorder Time: " << fixed << setprecision(3) << reorderSec << "s" << endl;
+  cout << "  Search Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  gen();
+  run(1, "Original", [&] {
+    vector<int> ord(V);
+    iota(ord.begin(), ord.end(), 0);
+    return ord;
+  });
+  run(2, "Degree", [&] { return degreeOrder(G); });
+  run(3, "Reverse Cuthill McKee", [&] { return reverseCuthillMcKeeOrder(G); });
+  run(4, "Gorder", [&] { return gorderOrder(G); });
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,359 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/components/BiconnectedComponents.h"
+#include "../../../../Content/C++/graph/components/Bridges.h"
+#include "../../../../Content/C++/graph/components/StronglyConnectedComponents.h"
+#include "../../../../Content/C++/graph/cycles/Cycle.h"
+#include "../../../../Content/C++/graph/cycles/DirectedCycle.h"
+#include "../../../../Content/C++/graph/queries/HLD.h"
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/search/DepthFirstOrder.h"
+using namespace std;
+
+namespace recursive {
+struct SCC {
+  int ind, top; vector<int> id, low, stk; vector<vector<int>> components;
+  template <class Digraph> void dfs(const Digraph &G, int v) {
+    id[stk[top++] = v] = -1; int mn = low[v] = ind++; for (int w : G[v]) {
+      if (id[w] == -2) dfs(G, w);
+      mn = min(mn, low[w]);
+    }
+    if (mn < low[v]) { low[v] = mn; return; }
+    int w; components.emplace_back(); do {
+      id[w = stk[--top]] = components.size() - 1; low[w] = INT_MAX;
+      components.back().push_back(w);
+    } while (w != v);
+  }
+  template <class Digraph> SCC(const Digraph &G)
+      : ind(0), top(0), id(G.size(), -2), low(G.size()), stk(G.size()) {
+    for (int v = 0; v < int(G.size()); v++) if (id[v] == -2) dfs(G, v);
+  }
+  template <class Digraph>
+  SCC(const Digraph &G, vector<pair<int, int>> &condensationEdges) : SCC(G) {
+    vector<int> last(components.size(), -1);
+    for (auto &&comp : components) for (int v : comp)
+      for (int w : G[v]) if (id[v] != id[w] && last[id[w]] != id[v])
+        condensationEdges.emplace_back(last[id[w]] = id[v], id[w]);
+  }
+};
+
+struct Bridges {
+  int ind, top; vector<int> id, low, pre, stk; vector<vector<int>> components;
+  vector<pair<int, int>> bridges;
+  void makeComponent(int v) {
+    int w; components.emplace_back(); do {
+      id[w = stk[--top]] = components.size() - 1;
+      components.back().push_back(w);
+    } while (w != v);
+  }
+  template <class Graph> void dfs(const Graph &G, int v, int prev) {
+    id[stk[top++] = v] = -1; low[v] = pre[v] = ind++; bool parEdge = false;
+    for (int w : G[v]) {
+      if (w == prev && !parEdge) { parEdge = true; continue; }
+      if (id[w] == -2) {
+        dfs(G, w, v); low[v] = min(low[v], low[w]);
+        if (low[w] == pre[w]) { bridges.emplace_back(v, w); makeComponent(w); }
+      } else if (id[w] == -1) low[v] = min(low[v], pre[w]);
+    }
+  }
+  template <class Graph> Bridges(const Graph &G)
+      : ind(0), top(0), id(G.size(), -2), low(G.size()), pre(G.size()),
+        stk(G.size()) {
+    for (int v = 0; v < int(G.size()); v++) if (id[v] == -2) {
+      dfs(G, v, -1); if (top > 0) makeComponent(v);
+    }
+  }
+};
+
+struct BCC {
+  int ind; vector<int> low, pre; vector<pair<int, int>> stk;
+  vector<vector<int>> ids, components; vector<bool> articulation;
+  void assign(int x, int id) {
+    if (ids[x].empty() || ids[x].back() != id) {
+      ids[x].push_back(id); components.back().push_back(x);
+    }
+  }
+  void makeComponent(int v = -1, int w = -1) {
+    int x, y, id = components.size(); components.emplace_back(); do {
+      tie(x, y) = stk.back(); stk.pop_back(); assign(x, id); assign(y, id);
+    } while (!stk.empty() && (x != v || y != w));
+  }
+  template <class Graph> void dfs(const Graph &G, int v, int prev) {
+    low[v] = pre[v] = ind++; int children = 0; for (int w : G[v]) {
+      if (pre[w] == -1) {
+        children++; stk.emplace_back(v, w); dfs(G, w, v);
+        low[v] = min(low[v], low[w]);
+        if ((prev == -1 && children > 1) || (prev != -1 && low[w] >= pre[v])) {
+          articulation[v] = true; makeComponent(v, w);
+        }
+      } else if (w != prev && pre[w] < low[v]) {
+        low[v] = pre[w]; stk.emplace_back(v, w);
+      }
+    }
+  }
+  template <class Graph> BCC(const Graph &G)
+      : ind(0), low(G.size()), pre(G.size(), -1),
+        ids(G.size()), articulation(G.size(), false) {
+    for (int v = 0; v < int(G.size()); v++) if (pre[v] == -1) {
+      dfs(G, v, -1); if (!stk.empty()) makeComponent();
+    }
+  }
+  template <class Graph>
+  BCC(const Graph &G, vector<pair<int, int>> &blockForestEdges) : BCC(G) {
+    for (int v = 0; v < int(G.size()); v++) if (articulation[v])
+      for (int id : ids[v])
+        blockForestEdges.emplace_back(v, int(G.size()) + id);
+  }
+};
+
+struct DFSOrder {
+  int V, curPre, curPost, curRevPost;
+  vector<int> preInd, postInd, revPostInd, preVert, postVert, revPostVert;
+  template <class Graph> void dfs(const Graph &G, int v) {
+    preVert[preInd[v] = curPre++] = v;
+    for (int w : G[v]) if (preInd[w] == -1) dfs(G, w);
+    postVert[postInd[v] = curPost++] = v;
+    revPostVert[revPostInd[v] = curRevPost--] = v;
+  }
+  template <class Graph> DFSOrder(const Graph &G, const vector<int> &roots)
+      : V(G.size()), curPre(0), curPost(0), curRevPost(V - 1), preInd(V, -1),
+        postInd(V), revPostInd(V), preVert(V), postVert(V), revPostVert(V) {
+    for (int v : roots) if (preInd[v] == -1) dfs(G, v);
+  }
+  template <class Graph> DFSOrder(const Graph &G, int rt)
+      : DFSOrder(G, vector<int>{rt}) {}
+};
+
+struct Cycle {
+  int V; vector<bool> vis; vector<int> to, cycle;
+  template <class Graph> void dfs(const Graph &G, int v, int prev) {
+    vis[v] = true; for (int w : G[v]) {
+      if (!vis[w]) dfs(G, w, to[w] = v);
+      else if (w != prev) {
+        for (int x = v; x != w; x = to[x]) cycle.push_back(x);
+        cycle.push_back(w); cycle.push_back(v);
+      }
+      if (!cycle.empty()) return;
+    }
+  }
+  template <class Graph>
+  Cycle(const Graph &G) : V(G.size()), vis(V, false), to(V) {
+    for (int v = 0; v < V; v++) {
+      for (int w : G[v]) {
+        if (v == w) { cycle.push_back(v); cycle.push_back(v); return; }
+        if (vis[w]) {
+          cycle.push_back(v); cycle.push_back(w); cycle.push_back(v); return;
+        }
+        vis[w] = true;
+      }
+      for (int w : G[v]) vis[w] = false;
+    }
+    fill(vis.begin(), vis.end(), false);
+    for (int v = 0; v < V && cycle.empty(); v++) if (!vis[v]) dfs(G, v, -1);
+  }
+};
+
+struct DirectedCycle {
+  int V; vector<bool> vis, onStk; vector<int> to, cycle;
+  template <class Digraph> void dfs(const Digraph &G, int v) {
+    vis[v] = onStk[v] = true; for (int w : G[v]) {
+      if (!vis[w]) { to[w] = v; dfs(G, w); }
+      else if (onStk[w]) {
+        for (int x = v; x != w; x = to[x]) cycle.push_back(x);
+        cycle.push_back(w); cycle.push_back(v);
+        reverse(cycle.begin(), cycle.end());
+      }
+      if (!cycle.empty()) return;
+    }
+    onStk[v] = false;
+  }
+  template <class Digraph> DirectedCycle(const Digraph &G)
+      : V(G.size()), vis(V, false), onStk(V, false), to(V) {
+    for (int v = 0; v < V && cycle.empty(); v++) if (!vis[v]) dfs(G, v);
+  }
+};
+
+struct HLD {
+  int V, ind; vector<int> root, dep, par, size, head, pre, post, vert;
+  template <class Forest>
+  void dfs(const Forest &G, int v, int prev, int r, int d) {
+    root[v] = r; dep[v] = d; par[v] = prev; size[v] = 1; for (int w : G[v])
+      if (w != prev) { dfs(G, w, v, r, d + 1); size[v] += size[w]; }
+  }
+  template <class Forest> void hld(const Forest &G, int v, int prev) {
+    if (head[v] == -1) head[v] = v;
+    vert[pre[v] = ++ind] = v; int heavy = -1;
+    for (int w : G[v]) if (w != prev && (heavy == -1 || size[heavy] < size[w]))
+      heavy = w;
+    if (heavy != -1) { head[heavy] = head[v]; hld(G, heavy, v); }
+    for (int w : G[v]) if (w != prev && w != heavy) hld(G, w, v);
+    post[v] = ind;
+  }
+  int lca(int v, int w) {
+    while (head[v] != head[w]) {
+      if (dep[head[v]] < dep[head[w]]) w = par[head[w]];
+      else v = par[head[v]];
+    }
+    return dep[v] < dep[w] ? v : w;
+  }
+  int dist(int v, int w) { return dep[v] + dep[w] - 2 * dep[lca(v, w)]; }
+  int kthParent(int v, int k) {
+    while (par[head[v]] != -1) {
+      if (pre[v] - pre[head[v]] >= k) return vert[pre[v] - k];
+      k -= pre[v] - pre[head[v]] + 1; v = par[head[v]];
+    }
+    return pre[v] < k ? -1 : vert[pre[v] - k];
+  }
+  int kthPath(int v, int w, int k) {
+    int LCA = lca(v, w);
+    if (dep[v] - dep[LCA] >= k) return kthParent(v, k);
+    else return kthParent(w, dep[v] + dep[w] - 2 * dep[LCA] - k);
+  }
+  bool connected(int v, int w) { return root[v] == root[w]; }
+  template <class Forest> HLD(const Forest &G)
+      : V(G.size()), ind(-1), root(V, -1), dep(V), par(V), size(V),
+        head(V, -1), pre(V), post(V), vert(V) {
+    for (int v = 0; v < V; v++)
+      if (root[v] == -1) { dfs(G, v, -1, v, 0); hld(G, v, -1); }
+  }
+};
+}
+
+template <class Graph>
+long long check(const Graph &G, bool forest, bool undirected) {
+  long long checkSum = 0;
+  int V = G.size();
+  if (forest) {
+    HLD A(G);
+    recursive::HLD B(G);
+    assert(A.root == B.root && A.dep == B.dep && A.par == B.par);
+    assert(A.size == B.size && A.head == B.head && A.pre == B.pre);
+    assert(A.post == B.post && A.vert == B.vert);
+    for (int v = 0; v < V; v++) checkSum = 31 * checkSum + A.head[v];
+    return checkSum;
+  }
+  vector<int> roots(V);
+  iota(roots.begin(), roots.end(), 0);
+  DFSOrder A(G, roots);
+  recursive::DFSOrder B(G, roots);
+  assert(A.preVert == B.preVert && A.postVert == B.postVert);
+  assert(A.revPostVert == B.revPostVert);
+  vector<pair<int, int>> DA, DB;
+  SCC C(G, DA);
+  recursive::SCC D(G, DB);
+  assert(C.id == D.id && C.components == D.components && DA == DB);
+  DirectedCycle L(G);
+  recursive::DirectedCycle M(G);
+  assert(L.cycle == M.cycle);
+  for (int v = 0; v < V; v++) checkSum = 31 * checkSum + A.preVert[v];
+  for (int v = 0; v < V; v++) checkSum = 31 * checkSum + C.id[v];
+  checkSum = 31 * checkSum + L.cycle.size();
+  if (!undirected) return checkSum;
+  Bridges E(G);
+  recursive::Bridges F(G);
+  assert(E.id == F.id && E.components == F.components);
+  assert(E.bridges == F.bridges);
+  vector<pair<int, int>> BA, BB;
+  BCC H(G, BA);
+  recursive::BCC I(G, BB);
+  assert(H.ids == I.ids && H.components == I.components);
+  assert(H.articulation == I.articulation && BA == BB);
+  Cycle J(G);
+  recursive::Cycle K(G);
+  assert(J.cycle == K.cycle);
+  for (int v = 0; v < V; v++) checkSum = 31 * checkSum + E.id[v];
+  checkSum = 31 * checkSum + H.components.size();
+  checkSum = 31 * checkSum + J.cycle.size();
+  return checkSum;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 10000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % 100, E = rng() % (V * (ti % 2 == 0 ? 1 : 4) + 1);
+    bool forest = ti % 5 == 0, bidirectional = ti % 3 == 0;
+    vector<vector<int>> A(V);
+    StaticGraph B(V);
+    B.reserveDiEdges(E * 2);
+    auto add = [&] (int v, int w) {
+      A[v].push_back(w);
+      B.addDiEdge(v, w);
+    };
+    if (forest) {
+      vector<int> P(V);
+      iota(P.begin(), P.end(), 0);
+      shuffle(P.begin(), P.end(), rng);
+      for (int i = 1; i < V; i++) if (rng() % 10 != 0) {
+        int j = rng() % i;
+        add(P[i], P[j]);
+        add(P[j], P[i]);
+      }
+    } else {
+      for (int i = 0; i < E; i++) {
+        int v = rng() % V, w = rng() % V;
+        add(v, w);
+        if (bidirectional) add(w, v);
+      }
+    }
+    B.build();
+    bool undirected = forest || bidirectional;
+    long long a = check(A, forest, undirected);
+    long long b = check(B, forest, undirected);
+    checkSum = 31 * checkSum + a;
+    checkSum = 31 * checkSum + b;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  int V = 1e6;
+  StaticGraph G(V), T(V);
+  G.reserveDiEdges(V * 2);
+  T.reserveDiEdges(V * 2);
+  for (int v = 0; v + 1 < V; v++) {
+    G.addBiEdge(v, v + 1);
+    T.addBiEdge(v, v + 1);
+  }
+  G.addBiEdge(V - 1, 0);
+  G.build();
+  T.build();
+  long long checkSum = 0;
+  const auto start_time = chrono::system_clock::now();
+  thread th([&] {
+    vector<int> roots{0};
+    DFSOrder A(G, roots);
+    SCC B(G);
+    Bridges C(G);
+    BCC D(G);
+    Cycle E(G);
+    DirectedCycle F(G);
+    HLD H(T);
+    checkSum = 31 * checkSum + A.postVert[0];
+    checkSum = 31 * checkSum + B.components.size();
+    checkSum = 31 * checkSum + C.components.size();
+    checkSum = 31 * checkSum + D.components.size();
+    checkSum = 31 * checkSum + E.cycle.size();
+    checkSum = 31 * checkSum + F.cycle.size();
+    checkSum = 31 * checkSum + H.dep[V - 1];
+  });
+  th.join();
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Deep Path on Worker Thread) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
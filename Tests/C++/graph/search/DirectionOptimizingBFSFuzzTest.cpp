@@ -0,0 +1,61 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/search/BreadthFirstSearch.h"
+#include "../../../../Content/C++/graph/search/DirectionOptimizingBFS.h"
+using namespace std;
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 2000;
+  long long checkSum = 0;
+  ThreadPool::global().setThreads(4);
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % (ti % 20 == 0 ? 100000 : 200);
+    int E = rng() % (V * (ti % 2 == 0 ? 2 : 20) + 1);
+    bool directed = ti % 3 == 0;
+    StaticGraph G(V), GT(V);
+    G.reserveDiEdges(E * 2);
+    GT.reserveDiEdges(E * 2);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      if (directed) {
+        G.addDiEdge(v, w);
+        GT.addDiEdge(w, v);
+      } else G.addBiEdge(v, w);
+    }
+    G.build();
+    GT.build();
+    vector<int> srcs;
+    for (int i = 0, k = 1 + rng() % 3; i < k; i++) srcs.push_back(rng() % V);
+    sort(srcs.begin(), srcs.end());
+    srcs.erase(unique(srcs.begin(), srcs.end()), srcs.end());
+    const StaticGraph &R = directed ? GT : G;
+    BFS<int> A(G, srcs);
+    DirectionOptimizingBFS<> B(G, R, srcs);
+    DirectionOptimizingBFS<ParallelPolicy> C(G, R, srcs);
+    assert(A.dist == B.dist && B.dist == C.dist && B.par == C.par);
+    for (int v = 0; v < V; v++) {
+      if (B.par[v] == -1) {
+        assert(B.dist[v] == 0 || B.dist[v] == INT_MAX);
+        continue;
+      }
+      bool found = false;
+      for (int w : G[B.par[v]]) if (w == v) found = true;
+      assert(found && B.dist[B.par[v]] + 1 == B.dist[v]);
+      checkSum = 31 * checkSum + B.par[v];
+    }
+  }
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  cout << "Test Passed" << endl;
+  return 0;
+}
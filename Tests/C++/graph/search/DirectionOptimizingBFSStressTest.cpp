@@ -0,0 +1,61 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/search/BreadthFirstSearch.h"
+#include "../../../../Content/C++/graph/search/DirectionOptimizingBFS.h"
+using namespace std;
+
+void run(const StaticGraph &G, const string &name, int subtest) {
+  auto start_time = chrono::system_clock::now();
+  BFS<int> A(G, 0);
+  auto end_time = chrono::system_clock::now();
+  double sec1 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  start_time = chrono::system_clock::now();
+  DirectionOptimizingBFS<> B(G, 0);
+  end_time = chrono::system_clock::now();
+  double sec2 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  ThreadPool::global().setThreads(4);
+  start_time = chrono::system_clock::now();
+  DirectionOptimizingBFS<ParallelPolicy> C(G, 0);
+  end_time = chrono::system_clock::now();
+  double sec3 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  assert(A.dist == B.dist && B.dist == C.dist && B.par == C.par);
+  long long checkSum = 0;
+  for (int v = 0; v < G.size(); v++) checkSum = 31 * checkSum + B.dist[v];
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  V: " << G.size() << endl;
+  cout << "  E: " << G.TO.size() << endl;
+  cout << "  BFS Time: " << fixed << setprecision(3) << sec1 << "s" << endl;
+  cout << "  Serial Time: " << fixed << setprecision(3) << sec2 << "s" << endl;
+  cout << "  Parallel Time: " << fixed << setprecision(3) << sec3 << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test1() {
+  mt19937_64 rng(0);
+  int V = 1e6, E = 1e7;
+  StaticGraph G(V);
+  G.reserveDiEdges(E * 2);
+  for (int i = 0; i < E; i++) G.addBiEdge(rng() % V, rng() % V);
+  G.build();
+  run(G, "Large Random Graph", 1);
+}
+
+void test2() {
+  int N = 1000, V = N * N;
+  StaticGraph G(V);
+  G.reserveDiEdges(V * 4);
+  for (int i = 0; i < N; i++) for (int j = 0; j < N; j++) {
+    if (i + 1 < N) G.addBiEdge(i * N + j, (i + 1) * N + j);
+    if (j + 1 < N) G.addBiEdge(i * N + j, i * N + j + 1);
+  }
+  G.build();
+  run(G, "Large Grid", 2);
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
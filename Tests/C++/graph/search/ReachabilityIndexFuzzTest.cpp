@@ -0,0 +1,76 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/search/ReachabilityIndex.h"
+#include "../../../../Content/C++/graph/search/TransitiveClosure.h"
+using namespace std;
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % 300, E = rng() % (V * (ti % 2 == 0 ? 2 : 5) + 1);
+    StaticGraph G(V);
+    G.reserveDiEdges(E);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      if (ti % 3 != 0 && v > w) swap(v, w);
+      G.addDiEdge(v, w);
+    }
+    G.build();
+    LeveledTransitiveClosureSCC<> A(G);
+    ReachabilityIndex B(G, 1 + rng() % 5, rng());
+    for (int v = 0; v < V; v++) for (int w = 0; w < V; w++) {
+      bool r = A.reachable(v, w);
+      assert(B.reachable(v, w) == r);
+      checkSum = 31 * checkSum + r;
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  mt19937_64 rng(0);
+  int V = 1e6, E = 3e6;
+  StaticGraph G(V);
+  G.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = rng() % V;
+    if (i % 100 != 0 && v > w) swap(v, w);
+    else if (i % 100 == 0) w = min(V - 1, v + int(rng() % 10));
+    G.addDiEdge(v, w);
+  }
+  G.build();
+  auto start_time = chrono::system_clock::now();
+  ReachabilityIndex R(G);
+  auto end_time = chrono::system_clock::now();
+  double sec1 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  int Q = 1e6;
+  long long checkSum = 0;
+  start_time = chrono::system_clock::now();
+  for (int i = 0; i < Q; i++) {
+    int v = rng() % V, w = rng() % V;
+    checkSum = 31 * checkSum + R.reachable(v, w);
+  }
+  end_time = chrono::system_clock::now();
+  double sec2 = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Large Graph) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Components: " << R.C << endl;
+  cout << "  Construction Time: " << fixed << setprecision(3) << sec1 << "s" << endl;
+  cout << "  Query Time: " << fixed << setprecision(3) << sec2 << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
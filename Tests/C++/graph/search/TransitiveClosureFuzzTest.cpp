@@ -0,0 +1,109 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/search/TransitiveClosure.h"
+using namespace std;
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  constexpr int MAXV = 300;
+  const int TESTCASES = 1000;
+  long long checkSum = 0;
+  ThreadPool::global().setThreads(4);
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % MAXV, E = rng() % (V * (ti % 2 == 0 ? 2 : 5) + 1);
+    StaticGraph G(V);
+    G.reserveDiEdges(E);
+    vector<bitset<MAXV>> matrix(V);
+    BitMatrix M(V, V);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      if (ti % 3 == 0 && v > w) swap(v, w);
+      G.addDiEdge(v, w);
+      matrix[v][w] = 1;
+      M.set(v, w);
+    }
+    G.build();
+    TransitiveClosureSCC<MAXV> A(G);
+    TransitiveClosureFloydWarshall<MAXV> B(matrix);
+    LeveledTransitiveClosureSCC<> C(G);
+    LeveledTransitiveClosureSCC<ParallelPolicy> D(G);
+    BlockedTransitiveClosureFloydWarshall<> F(M);
+    BlockedTransitiveClosureFloydWarshall<ParallelPolicy> H(M);
+    assert(C.dp.A == D.dp.A && F.dp.A == H.dp.A);
+    for (int v = 0; v < V; v++) {
+      vector<bool> vis(V, false);
+      vector<int> q{v};
+      vis[v] = true;
+      for (int i = 0; i < int(q.size()); i++) for (int w : G[q[i]]) {
+        if (!vis[w]) {
+          vis[w] = true;
+          q.push_back(w);
+        }
+      }
+      assert(int(q.size()) == F.dp.count(v));
+      for (int w = 0; w < V; w++) {
+        bool r = vis[w];
+        assert(A.reachable(v, w) == r);
+        assert(B.reachable(v, w) == r);
+        assert(C.reachable(v, w) == r);
+        assert(F.reachable(v, w) == r);
+        checkSum = 31 * checkSum + r;
+      }
+    }
+  }
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 300, M = rng() % 1000;
+    BitMatrix A(N, M), B(N, M);
+    vector<vector<bool>> a(N, vector<bool>(M, false)), b = a;
+    assert(A.W % 4 == 0 && A.W * 64 >= M);
+    for (int i = 0, K = rng() % (N * M / 4 + 1); i < K; i++) {
+      int r = rng() % N, c = rng() % M;
+      bool x = rng() % 3 != 0;
+      if (rng() % 2 == 0) {
+        A.set(r, c, x);
+        a[r][c] = x;
+      } else {
+        B.set(r, c, x);
+        b[r][c] = x;
+      }
+    }
+    for (int i = 0; i < N; i++) {
+      int k = rng() % N;
+      A.orRow(A[i], B[k]);
+      int cnt = 0;
+      for (int j = 0; j < M; j++) {
+        a[i][j] = a[i][j] || b[k][j];
+        assert(A.get(i, j) == a[i][j]);
+        cnt += a[i][j];
+      }
+      assert(A.count(i) == cnt);
+      checkSum = 31 * checkSum + cnt;
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Bit Matrix) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -315,6 +315,171 @@ void test10() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+void test11() {
+  mt19937_64 rng(0);
+  constexpr int V = 5e3, E = 2e4;
+  BitMatrix matrix(V, V);
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V;
+    int w = rng() % V;
+    if (v > w) swap(v, w);
+    matrix.set(v, w);
+  }
+  const auto start_time = chrono::system_clock::now();
+  BlockedTransitiveClosureFloydWarshall<> tc(matrix);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 11 (Blocked Floyd Warshall Lines) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  int Q = 1e7;
+  for (int i = 0; i < Q; i++) {
+    int v = rng() % V, w = rng() % V;
+    checkSum = 31 * checkSum + tc.reachable(v, w);
+  }
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test12() {
+  mt19937_64 rng(0);
+  constexpr int V = 5e3, E = 2e4;
+  BitMatrix matrix(V, V);
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V;
+    int w = rng() % V;
+    if (v > w) swap(v, w);
+    matrix.set(v, w);
+  }
+  ThreadPool::global().setThreads(4);
+  const auto start_time = chrono::system_clock::now();
+  BlockedTransitiveClosureFloydWarshall<ParallelPolicy> tc(matrix);
+  const auto end_time = chrono::system_clock::now();
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 12 (Parallel Blocked Floyd Warshall Lines) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  int Q = 1e7;
+  for (int i = 0; i < Q; i++) {
+    int v = rng() % V, w = rng() % V;
+    checkSum = 31 * checkSum + tc.reachable(v, w);
+  }
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test13() {
+  mt19937_64 rng(0);
+  constexpr int V = 5e4, E = 2e5;
+  StaticGraph G(V);
+  G.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) {
+    int v, w;
+    if (i < 1500) {
+      v = rng() % V;
+      w = rng() % V;
+    } else {
+      int c = rng() % 1000;
+      v = rng() % (V / 1000) + (V / 1000) * c;
+      w = rng() % (V / 1000) + (V / 1000) * c;
+    }
+    G.addDiEdge(v, w);
+  }
+  G.build();
+  const auto start_time = chrono::system_clock::now();
+  LeveledTransitiveClosureSCC<> tc(G);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 13 (Leveled SCC Random) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  int Q = 1e7;
+  for (int i = 0; i < Q; i++) {
+    int v = rng() % V, w = rng() % V;
+    checkSum = 31 * checkSum + tc.reachable(v, w);
+  }
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test14() {
+  mt19937_64 rng(0);
+  constexpr int V = 5e4, E = 2e5;
+  StaticGraph G(V);
+  G.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) {
+    int v, w;
+    if (i < 1500) {
+      v = rng() % V;
+      w = rng() % V;
+    } else {
+      int c = rng() % 1000;
+      v = rng() % (V / 1000) + (V / 1000) * c;
+      w = rng() % (V / 1000) + (V / 1000) * c;
+    }
+    G.addDiEdge(v, w);
+  }
+  G.build();
+  ThreadPool::global().setThreads(4);
+  const auto start_time = chrono::system_clock::now();
+  LeveledTransitiveClosureSCC<ParallelPolicy> tc(G);
+  const auto end_time = chrono::system_clock::now();
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 14 (Parallel Leveled SCC Random) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  int Q = 1e7;
+  for (int i = 0; i < Q; i++) {
+    int v = rng() % V, w = rng() % V;
+    checkSum = 31 * checkSum + tc.reachable(v, w);
+  }
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test15() {
+  mt19937_64 rng(0);
+  constexpr int V = 2e5, E = 1e6;
+  StaticGraph G(V);
+  G.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) {
+    int v, w;
+    if (i < 5000) {
+      v = rng() % V;
+      w = rng() % V;
+    } else {
+      int c = rng() % 2000;
+      v = rng() % (V / 2000) + (V / 2000) * c;
+      w = rng() % (V / 2000) + (V / 2000) * c;
+    }
+    G.addDiEdge(v, w);
+  }
+  G.build();
+  ThreadPool::global().setThreads(4);
+  const auto start_time = chrono::system_clock::now();
+  LeveledTransitiveClosureSCC<ParallelPolicy> tc(G);
+  const auto end_time = chrono::system_clock::now();
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 15 (Parallel Leveled SCC Clusters) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  int Q = 1e7;
+  for (int i = 0; i < Q; i++) {
+    int v = rng() % V, w = rng() % V;
+    checkSum = 31 * checkSum + tc.reachable(v, w);
+  }
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
   test2();
@@ -326,6 +491,11 @@ int main() {
   test8();
   test9();
   test10();
+  test11();
+  test12();
+  test13();
+  test14();
+  test15();
   cout << "Test Passed" << endl;
   return 0;
 }
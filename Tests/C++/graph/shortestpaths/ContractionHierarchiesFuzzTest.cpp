@@ -0,0 +1,99 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/shortestpaths/ContractionHierarchies.h"
+#include "../../../../Content/C++/graph/shortestpaths/DijkstraSSSP.h"
+using namespace std;
+
+template <class T>
+void checkPath(const vector<tuple<int, int, T, int>> &edges, const vector<tuple<int, int, T>> &path, int s, int t, T d) {
+  set<tuple<int, int, T>> E;
+  for (auto &&e : edges) E.emplace(get<0>(e), get<1>(e), get<2>(e));
+  T sum = 0;
+  int cur = s;
+  for (auto &&e : path) {
+    assert(get<0>(e) == cur);
+    assert(E.count(e));
+    sum += get<2>(e);
+    cur = get<1>(e);
+  }
+  assert(cur == t && sum == d);
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % 60, E = rng() % (V * 4 + 1), MAXW = ti % 3 == 0 ? 2 : 100;
+    StaticWeightedGraph<long long> G(V);
+    vector<tuple<int, int, long long, int>> edges;
+    G.reserveDiEdges(E);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      long long weight = rng() % MAXW;
+      G.addDiEdge(v, w, weight);
+      edges.emplace_back(v, w, weight, i);
+    }
+    G.build();
+    ContractionHierarchies<long long> CH(G, 1 + rng() % 20);
+    for (int s = 0; s < V; s++) {
+      DijkstraSSSP<long long> sssp(G, s);
+      for (int t = 0; t < V; t++) {
+        long long d = CH.dist(s, t);
+        assert(d == sssp.dist[t]);
+        if (d != CH.INF) checkPath(edges, CH.getPath(s, t), s, t, d);
+        else assert(CH.getPath(s, t).empty());
+        checkSum = 31 * checkSum + d;
+      }
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (Random Graphs) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  mt19937_64 rng(0);
+  const int N = 150, V = N * N, Q = 1e4;
+  StaticWeightedGraph<long long> G(V);
+  for (int i = 0; i < N; i++) for (int j = 0; j < N; j++) {
+    int v = i * N + j;
+    if (i + 1 < N) G.addBiEdge(v, v + N, 1 + rng() % 100);
+    if (j + 1 < N) G.addBiEdge(v, v + 1, 1 + rng() % 100);
+  }
+  G.build();
+  auto start_time = chrono::system_clock::now();
+  ContractionHierarchies<long long> CH(G);
+  auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  int shortcuts = int(CH.up.TO.size() + CH.down.TO.size()) - int(G.TO.size());
+  long long checkSum = 0;
+  start_time = chrono::system_clock::now();
+  for (int q = 0; q < Q; q++) {
+    int s = rng() % V, t = rng() % V;
+    checkSum = 31 * checkSum + CH.dist(s, t);
+  }
+  end_time = chrono::system_clock::now();
+  double qsec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  for (int q = 0; q < 20; q++) {
+    int s = rng() % V, t = rng() % V;
+    DijkstraSSSP<long long> sssp(G, s);
+    assert(CH.dist(s, t) == sssp.dist[t]);
+  }
+  cout << "Subtest 2 (Grid) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  Shortcuts: " << shortcuts << endl;
+  cout << "  Preprocessing Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Query Time: " << fixed << setprecision(3) << qsec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
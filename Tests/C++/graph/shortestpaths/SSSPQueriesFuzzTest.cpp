@@ -0,0 +1,116 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/search/BreadthFirstSearch.h"
+#include "../../../../Content/C++/graph/search/ZeroOneBreadthFirstSearch.h"
+#include "../../../../Content/C++/graph/shortestpaths/DijkstraSSSP.h"
+#include "../../../../Content/C++/graph/shortestpaths/SSSPQueries.h"
+using namespace std;
+
+template <class Query, class SSSP, class T, class Graph>
+void check(const Graph &G, Query &q, const SSSP &sssp, const vector<int> &targets, T INF) {
+  int V = G.size();
+  for (int v = 0; v < V; v++) {
+    if (!targets.empty() && find(targets.begin(), targets.end(), v) == targets.end()) continue;
+    assert(q.dist(v) == (sssp.dist[v] == INF ? q.INF : sssp.dist[v]));
+    if (q.dist(v) != q.INF && q.par(v) != -1) {
+      T w = q.dist(v) - q.dist(q.par(v));
+      bool found = false;
+      for (auto &&e : G[q.par(v)]) if (e.first == v && e.second == w) found = true;
+      assert(found);
+      auto path = q.getPath(v);
+      assert(get<1>(path.back()) == v && q.dist(get<0>(path[0])) == 0);
+    }
+  }
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 200;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % 100, E = rng() % (V * 4 + 1);
+    StaticWeightedGraph<long long> G(V), Z(V), U(V);
+    G.reserveDiEdges(E);
+    Z.reserveDiEdges(E);
+    U.reserveDiEdges(E);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      G.addDiEdge(v, w, rng() % 100);
+      Z.addDiEdge(v, w, rng() % 2);
+      U.addDiEdge(v, w, 1);
+    }
+    G.build();
+    Z.build();
+    U.build();
+    DijkstraQuery<long long> dq(V);
+    BFSQuery<long long> bq(V);
+    ZeroOneBFSQuery zq(V);
+    for (int qi = 0; qi < 50; qi++) {
+      vector<int> srcs, targets;
+      for (int i = 0, k = 1 + rng() % 3; i < k; i++) srcs.push_back(rng() % V);
+      sort(srcs.begin(), srcs.end());
+      srcs.erase(unique(srcs.begin(), srcs.end()), srcs.end());
+      if (qi % 2 == 0) for (int i = 0, k = 1 + rng() % 3; i < k; i++) targets.push_back(rng() % V);
+      DijkstraSSSP<long long> A(G, srcs);
+      dq.run(G, srcs, targets);
+      check(G, dq, A, targets, A.INF);
+      BFS<long long> B(U, srcs);
+      bq.run(U, srcs, targets);
+      check(U, bq, B, targets, B.INF);
+      ZeroOneBFS C(Z, srcs);
+      zq.run(Z, srcs, targets);
+      check(Z, zq, C, targets, INT_MAX);
+      for (int v = 0; v < V; v++) checkSum = 31 * checkSum + A.dist[v];
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (Queries) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 20;
+  long long checkSum = 0;
+  ThreadPool::global().setThreads(4);
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % 5000, E = rng() % (V * 4 + 1);
+    StaticWeightedGraph<long long> G(V);
+    G.reserveDiEdges(E);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      G.addDiEdge(v, w, rng() % 1000);
+    }
+    G.build();
+    vector<int> srcs, targets;
+    for (int i = 0, k = rng() % 50; i < k; i++) srcs.push_back(rng() % V);
+    for (int i = 0, k = rng() % 50; i < k; i++) targets.push_back(rng() % V);
+    auto A = distanceTable<DijkstraQuery<long long>>(G, srcs, targets);
+    auto B = distanceTable<DijkstraQuery<long long>, ParallelPolicy>(G, srcs, targets);
+    assert(A == B);
+    for (int i = 0; i < int(srcs.size()); i++) {
+      DijkstraSSSP<long long> sssp(G, srcs[i]);
+      for (int j = 0; j < int(targets.size()); j++) {
+        assert(A[i][j] == sssp.dist[targets[j]]);
+        checkSum = 31 * checkSum + A[i][j];
+      }
+    }
+  }
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Distance Table) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
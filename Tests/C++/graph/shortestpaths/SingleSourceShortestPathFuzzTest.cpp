@@ -0,0 +1,100 @@
+#include <bits/stdc++.h>
+#include "../../../../Content/C++/graph/representations/StaticGraph.h"
+#include "../../../../Content/C++/graph/shortestpaths/DeltaSteppingSSSP.h"
+#include "../../../../Content/C++/graph/shortestpaths/DijkstraSSSP.h"
+using namespace std;
+
+template <class T, class SSSP, class Graph>
+void check(const Graph &G, const vector<int> &srcs, const vector<T> &dist, SSSP &sssp) {
+  int V = G.size();
+  assert(sssp.dist == dist);
+  vector<bool> isSrc(V, false);
+  for (int s : srcs) isSrc[s] = true;
+  for (int v = 0; v < V; v++) {
+    if (isSrc[v] || dist[v] == sssp.INF) {
+      assert(sssp.par[v] == -1);
+      continue;
+    }
+    int u = sssp.par[v];
+    assert(u != -1);
+    bool found = false;
+    for (auto &&e : G[u]) if (e.first == v && dist[u] + e.second == dist[v]) found = true;
+    assert(found);
+    auto path = sssp.getPath(v);
+    assert(!path.empty() && isSrc[get<0>(path[0])] && get<1>(path.back()) == v);
+    assert(int(path.size()) <= V);
+  }
+}
+
+template <class T> void test(int TESTCASES, bool real, const string &name, int subtest) {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  long long checkSum = 0;
+  ThreadPool::global().setThreads(4);
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % (ti % 10 == 0 ? 20000 : 50), E = rng() % (V * 4 + 1);
+    int MAXW = ti % 4 == 0 ? 1 : ti % 4 == 1 ? 10 : int(1e9);
+    StaticWeightedGraph<T> G(V);
+    G.reserveDiEdges(E);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      T weight = real ? T(rng() % MAXW) / 7 : T(rng() % (MAXW + 1));
+      G.addDiEdge(v, w, weight);
+    }
+    G.build();
+    vector<int> srcs;
+    for (int i = 0, k = 1 + rng() % 3; i < k; i++) srcs.push_back(rng() % V);
+    DijkstraSSSP<T> A(G, srcs);
+    check(G, srcs, A.dist, A);
+    DeltaSteppingSSSP<T> B(G, srcs);
+    check(G, srcs, A.dist, B);
+    DeltaSteppingSSSP<T, ParallelPolicy> C(G, srcs, numeric_limits<T>::max(), T(1 + rng() % (MAXW + 1)));
+    check(G, srcs, A.dist, C);
+    DeltaSteppingSSSP<T, ParallelPolicy> D(G, srcs, numeric_limits<T>::max(), max(T(1), T(MAXW / (V * 10))));
+    check(G, srcs, A.dist, D);
+    for (int v = 0; v < V; v++) checkSum = 31 * checkSum + (long long)A.dist[v];
+  }
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest " << subtest << " (" << name << ") Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int V = 1 + rng() % (ti % 10 == 0 ? 20000 : 50), E = rng() % (V * 4 + 1);
+    int MAXW = ti % 4 == 0 ? 1 : ti % 4 == 1 ? 10 : int(1e9);
+    StaticWeightedGraph<long long> G(V);
+    G.reserveDiEdges(E);
+    for (int i = 0; i < E; i++) {
+      int v = rng() % V, w = rng() % V;
+      G.addDiEdge(v, w, rng() % (MAXW + 1));
+    }
+    G.build();
+    vector<int> srcs;
+    for (int i = 0, k = 1 + rng() % 3; i < k; i++) srcs.push_back(rng() % V);
+    DijkstraSSSP<long long> A(G, srcs);
+    DijkstraSSSP<long long, true> B(G, srcs);
+    check(G, srcs, A.dist, B);
+    for (int v = 0; v < V; v++) checkSum = 31 * checkSum + B.dist[v];
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (Radix Dijkstra) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test<long long>(1000, false, "Delta Stepping Integral", 1);
+  test<double>(1000, true, "Delta Stepping Real", 2);
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -2,6 +2,7 @@
 #include "../../../../Content/C++/graph/representations/StaticGraph.h"
 #include "../../../../Content/C++/graph/shortestpaths/BellmanFordSSSP.h"
 #include "../../../../Content/C++/graph/shortestpaths/ClassicalDijkstraSSSP.h"
+#include "../../../../Content/C++/graph/shortestpaths/DeltaSteppingSSSP.h"
 #include "../../../../Content/C++/graph/shortestpaths/DijkstraSSSP.h"
 using namespace std;
 
@@ -147,6 +148,80 @@ void test6() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+void test7() {
+  mt19937_64 rng(0);
+  int V = 1e6, E = 4e6;
+  StaticWeightedGraph<long long> G(V);
+  G.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = rng() % V;
+    long long weight = rng() % int(1e9) + 1;
+    G.addDiEdge(v, w, weight);
+  }
+  G.build();
+  const auto start_time = chrono::system_clock::now();
+  DijkstraSSSP<long long, true> sssp(G, 0);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 7 (Dijkstra with Radix PQ) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (int v = 0; v < V; v++) checkSum = 31 * checkSum + sssp.dist[v];
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test8() {
+  mt19937_64 rng(0);
+  int V = 1e6, E = 4e6;
+  StaticWeightedGraph<long long> G(V);
+  G.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = rng() % V;
+    long long weight = rng() % int(1e9) + 1;
+    G.addDiEdge(v, w, weight);
+  }
+  G.build();
+  const auto start_time = chrono::system_clock::now();
+  DeltaSteppingSSSP<long long> sssp(G, 0);
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 8 (Delta Stepping) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (int v = 0; v < V; v++) checkSum = 31 * checkSum + sssp.dist[v];
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test9() {
+  mt19937_64 rng(0);
+  int V = 1e6, E = 4e6;
+  StaticWeightedGraph<long long> G(V);
+  G.reserveDiEdges(E);
+  for (int i = 0; i < E; i++) {
+    int v = rng() % V, w = rng() % V;
+    long long weight = rng() % int(1e9) + 1;
+    G.addDiEdge(v, w, weight);
+  }
+  G.build();
+  ThreadPool::global().setThreads(4);
+  const auto start_time = chrono::system_clock::now();
+  DeltaSteppingSSSP<long long, ParallelPolicy> sssp(G, 0);
+  const auto end_time = chrono::system_clock::now();
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 9 (Parallel Delta Stepping) Passed" << endl;
+  cout << "  V: " << V << endl;
+  cout << "  E: " << E << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  long long checkSum = 0;
+  for (int v = 0; v < V; v++) checkSum = 31 * checkSum + sssp.dist[v];
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
   test2();
@@ -154,6 +229,9 @@ int main() {
   test4();
   test5();
   test6();
+  test7();
+  test8();
+  test9();
   cout << "Test Passed" << endl;
   return 0;
 }
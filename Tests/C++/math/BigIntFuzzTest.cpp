@@ -0,0 +1,136 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/BigInt.h"
+using namespace std;
+
+string toString(__int128_t v) {
+  if (v == 0) return "0";
+  string s;
+  bool neg = v < 0;
+  __uint128_t m = neg ? -(__uint128_t)v : (__uint128_t)v;
+  for (; m > 0; m /= 10) s.push_back('0' + m % 10);
+  if (neg) s.push_back('-');
+  reverse(s.begin(), s.end());
+  return s;
+}
+
+BigInt randomBigInt(mt19937_64 &rng, int limbs) {
+  BigInt ret;
+  ret.a.resize(rng() % limbs + 1);
+  for (auto &&x : ret.a) x = rng() % 4 == 0 ? (rng() % 2 == 0 ? 0 : ~0U) : uint32_t(rng());
+  ret.sign = rng() % 2 == 0 ? 1 : -1;
+  ret.trim();
+  return ret;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 100000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    long long x = rng() >> (rng() % 64), y = rng() >> (rng() % 64);
+    if (rng() % 2 == 0) x = -x;
+    if (rng() % 2 == 0) y = -y;
+    if (y == 0) y = 1;
+    BigInt a(x), b(toString(y));
+    assert(a.write() == toString(x) && b.value() == y);
+    assert((a + b).write() == toString(__int128_t(x) + y));
+    assert((a - b).write() == toString(__int128_t(x) - y));
+    assert((a * b).write() == toString(__int128_t(x) * y));
+    assert((a * y).write() == toString(__int128_t(x) * y));
+    assert((a / b).write() == toString(x / y) && (a / y).write() == toString(x / y));
+    assert((a % b).write() == toString(x % y) && a % y == x % y);
+    assert((a < b) == (x < y) && (a == b) == (x == y) && (a >= b) == (x >= y));
+    checkSum = 31 * checkSum + (a * b).value();
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (Small Values) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 400;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int limbs = ti % 20 == 0 ? 20000 : ti % 4 == 0 ? 2000 : 200;
+    BigInt a = randomBigInt(rng, limbs), b = randomBigInt(rng, limbs), c = randomBigInt(rng, limbs);
+    BigInt::Mag s(a.a.size() + b.a.size());
+    if (!a.isZero() && !b.isZero() && limbs <= 2000) {
+      BigInt::mulSchoolbook(a.a.data(), a.a.size(), b.a.data(), b.a.size(), s.data());
+      BigInt::trim(s);
+      assert(BigInt::mulKaratsuba(a.a.data(), a.a.size(), b.a.data(), b.a.size()) == s);
+      assert(BigInt::mulNTT(a.a, b.a) == s);
+    }
+    assert(a * (b + c) == a * b + a * c);
+    assert((a - b) + b == a && a * a == a * BigInt(a));
+    if (!b.isZero()) {
+      BigInt x = a * b + c;
+      pair<BigInt, BigInt> qr = divmod(x, b);
+      assert(qr.first * b + qr.second == x);
+      assert(qr.second.abs() < b.abs());
+      assert(qr.second.isZero() || qr.second.sign == x.sign);
+      BigInt y = x;
+      y /= b;
+      assert(y == qr.first);
+      y = x;
+      y %= b;
+      assert(y == qr.second);
+      checkSum = 31 * checkSum + qr.first.value();
+    }
+    BigInt d = a;
+    d += d;
+    d -= a;
+    assert(d == a);
+    d -= d;
+    assert(d.isZero() && d.sign == 1);
+    if (limbs <= 2000) assert(BigInt(a.write()) == a);
+    checkSum = 31 * checkSum + (a * b).value();
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Large Values) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  const int THREADS = 4, TESTCASES = 3;
+  vector<long long> sums(THREADS, 0);
+  vector<thread> threads;
+  for (int t = 0; t < THREADS; t++) threads.emplace_back([&, t] {
+    mt19937_64 rng(t);
+    for (int ti = 0; ti < TESTCASES; ti++) {
+      int len = 200000 - int(rng() % 1000);
+      string s(len, '0');
+      s[0] = '1' + rng() % 9;
+      for (int i = 1; i < len; i++) s[i] = '0' + rng() % 10;
+      if (rng() % 2 == 0) s = "-" + s;
+      BigInt a(s);
+      assert(a.write() == s);
+      BigInt b = a * a;
+      assert(BigInt(b.write()) == b);
+      sums[t] = 31 * sums[t] + b.value();
+    }
+  });
+  for (auto &&th : threads) th.join();
+  long long checkSum = 0;
+  for (auto &&s : sums) checkSum = 31 * checkSum + s;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (Concurrent Conversions) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
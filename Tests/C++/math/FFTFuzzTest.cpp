@@ -0,0 +1,89 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/FFT.h"
+using namespace std;
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 500 + 1, M = rng() % 500 + 1;
+    long long MAXV = ti % 3 == 0 ? 10 : ti % 3 == 1 ? 1e4 : 1e9;
+    vector<long long> A(N), B(M), C, D(N + M - 1, 0);
+    for (auto &&a : A) a = rng() % MAXV - (ti % 5 == 0 ? MAXV / 2 : 0);
+    for (auto &&b : B) b = rng() % MAXV;
+    for (int i = 0; i < N; i++) for (int j = 0; j < M; j++) D[i + j] += A[i] * B[j];
+    convolve(A, B, C);
+    assert(C == D);
+    for (auto &&c : C) checkSum = 31 * checkSum + c;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (Convolution) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 100;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 2000 + 1, M = rng() % 2000 + 1;
+    vector<long long> A(N), B(M), C, D(N + M, 0);
+    for (auto &&a : A) a = rng() % 10000;
+    for (auto &&b : B) b = rng() % 10000;
+    A.back() = B.back() = 1;
+    for (int i = 0; i < N; i++) for (int j = 0; j < M; j++) D[i + j] += A[i] * B[j];
+    long long carry = 0;
+    for (auto &&d : D) { d += carry; carry = d / 10000; d %= 10000; }
+    while (int(D.size()) > 1 && D.back() == 0) D.pop_back();
+    multiply(A, B, C, true);
+    assert(C == D);
+    for (auto &&c : C) checkSum = 31 * checkSum + c;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Integer Multiplication) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  const int THREADS = 4, TESTCASES = 50;
+  vector<long long> sums(THREADS, 0);
+  vector<thread> threads;
+  for (int t = 0; t < THREADS; t++) threads.emplace_back([&, t] {
+    mt19937_64 rng(t);
+    for (int ti = 0; ti < TESTCASES; ti++) {
+      int N = rng() % (ti * 20 + 1) + 1, M = rng() % (ti * 20 + 1) + 1;
+      long long MAXV = ti % 2 == 0 ? 1e4 : 1e9;
+      vector<long long> A(N), B(M), C, D(N + M - 1, 0);
+      for (auto &&a : A) a = rng() % MAXV;
+      for (auto &&b : B) b = rng() % MAXV;
+      for (int i = 0; i < N; i++) for (int j = 0; j < M; j++) D[i + j] += A[i] * B[j];
+      convolve(A, B, C);
+      assert(C == D);
+      for (auto &&c : C) sums[t] = 31 * sums[t] + c;
+    }
+  });
+  for (auto &&th : threads) th.join();
+  long long checkSum = 0;
+  for (auto &&s : sums) checkSum = 31 * checkSum + s;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (Concurrent Calls) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
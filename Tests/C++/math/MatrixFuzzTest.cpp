@@ -0,0 +1,143 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/Matrix.h"
+using namespace std;
+
+template <class T> Matrix<T> naive(const Matrix<T> &A, const Matrix<T> &B, T mod) {
+  Matrix<T> C(A.N, B.M);
+  for (int i = 0; i < A.N; i++) for (int j = 0; j < B.M; j++) {
+    __int128_t s = 0;
+    for (int k = 0; k < A.M; k++) s += __int128_t(A[i][k]) * B[k][j];
+    C[i][j] = mod == 0 ? T(s) : T(s % mod);
+  }
+  return C;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 300;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 70 + 1, K = rng() % 70 + 1, M = rng() % 70 + 1;
+    Matrix<long long> A(N, K), B(K, M);
+    for (auto &&a : A.a) a = (long long)(rng() % 2001) - 1000;
+    for (auto &&b : B.a) b = (long long)(rng() % 2001) - 1000;
+    Matrix<long long> C = naive(A, B, 0LL);
+    assert(mul(A, B).a == C.a);
+    assert(mulStrassen(A, B, int(rng() % 8) + 1).a == C.a);
+    Matrix<int> AI(N, K), BI(K, M);
+    for (int i = 0; i < N * K; i++) AI.a[i] = A.a[i];
+    for (int i = 0; i < K * M; i++) BI.a[i] = B.a[i];
+    Matrix<int> CI = mul(AI, BI);
+    for (int i = 0; i < N * M; i++) assert(CI.a[i] == C.a[i]);
+    Matrix<double> AD(N, K), BD(K, M);
+    for (int i = 0; i < N * K; i++) AD.a[i] = A.a[i];
+    for (int i = 0; i < K * M; i++) BD.a[i] = B.a[i];
+    Matrix<double> CD = mul(AD, BD);
+    for (int i = 0; i < N * M; i++) assert(CD.a[i] == C.a[i]);
+    for (auto &&c : C.a) checkSum = 31 * checkSum + c;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (Multiplication) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 300;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    long long MOD = ti % 3 == 0 ? (1LL << 31) : ti % 3 == 1 ? 1e9 + 7 : rng() % 1000 + 1;
+    int N = rng() % 70 + 1, K = rng() % 70 + 1, M = rng() % 70 + 1;
+    Matrix<long long> A(N, K), B(K, M);
+    for (auto &&a : A.a) a = rng() % MOD;
+    for (auto &&b : B.a) b = rng() % MOD;
+    Matrix<long long> C = naive(A, B, MOD);
+    assert(mulMod(A, B, MOD).a == C.a);
+    assert(mulModStrassen(A, B, MOD, int(rng() % 8) + 1).a == C.a);
+    Matrix<long long> S(N, N), P = identity<long long>(N);
+    for (auto &&s : S.a) s = rng() % MOD;
+    int e = rng() % 10;
+    for (int i = 0; i < e; i++) P = naive(P, S, MOD);
+    if (MOD == 1) P = Matrix<long long>(N, N);
+    assert(pow(S, e, MOD).a == P.a);
+    for (auto &&c : C.a) checkSum = 31 * checkSum + c;
+    for (auto &&p : P.a) checkSum = 31 * checkSum + p;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Modular Multiplication) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 50;
+  long long checkSum = 0;
+  ThreadPool::global().setThreads(4);
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    long long MOD = ti % 2 == 0 ? 1e9 + 7 : rng() % 1000 + 1;
+    int N = rng() % 200 + 1, K = rng() % 200 + 1, M = rng() % 200 + 1;
+    Matrix<long long> A(N, K), B(K, M);
+    for (auto &&a : A.a) a = rng() % MOD;
+    for (auto &&b : B.a) b = rng() % MOD;
+    Matrix<long long> C = mulMod(A, B, MOD);
+    assert(mulMod<ParallelPolicy>(A, B, MOD).a == C.a);
+    assert(mulModStrassen<ParallelPolicy>(A, B, MOD, 16).a == C.a);
+    Matrix<double> AD(N, K), BD(K, M);
+    uniform_real_distribution<double> dis(-1, 1);
+    for (auto &&a : AD.a) a = dis(rng);
+    for (auto &&b : BD.a) b = dis(rng);
+    assert(mul(AD, BD).a == mul<ParallelPolicy>(AD, BD).a);
+    Matrix<long long> S(N, N);
+    for (auto &&s : S.a) s = rng() % MOD;
+    long long e = rng() % 100;
+    Matrix<long long> P = pow<ParallelPolicy>(S, e, MOD);
+    assert(pow(S, e, MOD).a == P.a);
+    for (auto &&c : C.a) checkSum = 31 * checkSum + c;
+    for (auto &&p : P.a) checkSum = 31 * checkSum + p;
+  }
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (Parallel) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test4() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 100;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int MOD = INT_MAX - int(rng() % 100);
+    int N = rng() % 70 + 1, K = rng() % 70 + 1, M = rng() % 70 + 1;
+    Matrix<int> A(N, K), B(K, M);
+    for (auto &&a : A.a) a = MOD - 1 - rng() % 1000;
+    for (auto &&b : B.a) b = rng() % 2 == 0 ? MOD - 1 - rng() % 1000 : rng() % MOD;
+    Matrix<int> C = naive(A, B, MOD);
+    assert(mulMod(A, B, MOD).a == C.a);
+    assert(mulModStrassen(A, B, MOD, int(rng() % 8) + 1).a == C.a);
+    for (auto &&c : C.a) checkSum = 31 * checkSum + c;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 4 (Modular Multiplication, Int) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  test4();
+  cout << "Test Passed" << endl;
+  return 0;
+}
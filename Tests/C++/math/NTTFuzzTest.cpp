@@ -0,0 +1,101 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/NTT.h"
+using namespace std;
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 200;
+  long long checkSum = 0;
+  for (long long MOD : {998244353LL, 167772161LL, 469762049LL, 1004535809LL}) {
+    NTT ntt(MOD, 3);
+    for (int ti = 0; ti < TESTCASES; ti++) {
+      int N = rng() % 500 + 1, M = rng() % 500 + 1;
+      bool eq = rng() % 4 == 0;
+      if (eq) M = N;
+      vector<long long> A(N), B(M), C, D(N + M - 1, 0);
+      for (auto &&a : A) a = rng() % MOD;
+      for (auto &&b : B) b = rng() % MOD;
+      if (eq) B = A;
+      for (int i = 0; i < N; i++) for (int j = 0; j < M; j++) D[i + j] = (D[i + j] + A[i] * B[j] % MOD) % MOD;
+      ntt.multiply(A, B, C, eq);
+      assert(C == D);
+      for (auto &&c : C) checkSum = 31 * checkSum + c;
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (NTT Primes) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 200;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    long long MOD = ti % 2 == 0 ? 1e9 + 7 : rng() % int(2e9) + 1;
+    int N = rng() % 500 + 1, M = rng() % 500 + 1;
+    vector<long long> A(N), B(M), C, D(N + M - 1, 0);
+    for (auto &&a : A) a = rng() % MOD;
+    for (auto &&b : B) b = rng() % MOD;
+    for (int i = 0; i < N; i++) for (int j = 0; j < M; j++) D[i + j] = (D[i + j] + A[i] * B[j] % MOD) % MOD;
+    while (int(D.size()) > 1 && D.back() == 0) D.pop_back();
+    multiplyMod(A, B, C, MOD);
+    assert(C == D);
+    for (auto &&c : C) checkSum = 31 * checkSum + c;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Arbitrary Mod) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  const int THREADS = 4, TESTCASES = 50;
+  vector<long long> sums(THREADS, 0);
+  vector<thread> threads;
+  for (int t = 0; t < THREADS; t++) threads.emplace_back([&, t] {
+    mt19937_64 rng(t);
+    for (int ti = 0; ti < TESTCASES; ti++) {
+      long long MOD = 1e9 + 7;
+      int N = rng() % (ti * 20 + 1) + 1, M = rng() % (ti * 20 + 1) + 1;
+      vector<long long> A(N), B(M), C, E, D(N + M - 1, 0), F(N + M - 1, 0);
+      for (auto &&a : A) a = rng() % MOD;
+      for (auto &&b : B) b = rng() % MOD;
+      for (int i = 0; i < N; i++) for (int j = 0; j < M; j++) {
+        D[i + j] = (D[i + j] + A[i] * B[j] % MOD) % MOD;
+        F[i + j] = (F[i + j] + A[i] * B[j] % 998244353) % 998244353;
+      }
+      while (int(D.size()) > 1 && D.back() == 0) D.pop_back();
+      while (int(F.size()) > 1 && F.back() == 0) F.pop_back();
+      multiplyMod(A, B, C, MOD);
+      for (auto &&a : A) a %= 998244353;
+      for (auto &&b : B) b %= 998244353;
+      multiply(A, B, E);
+      assert(C == D);
+      assert(E == F);
+      for (auto &&c : C) sums[t] = 31 * sums[t] + c;
+    }
+  });
+  for (auto &&th : threads) th.join();
+  long long checkSum = 0;
+  for (auto &&s : sums) checkSum = 31 * checkSum + s;
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (Concurrent Calls) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,85 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/Polynomial.h"
+using namespace std;
+
+const unsigned MOD = 998244353;
+
+Poly<> naiveMul(const Poly<> &a, const Poly<> &b) {
+  Poly<> c(a.size() + b.size() - 1, 0);
+  for (int i = 0; i < int(a.size()); i++) for (int j = 0; j < int(b.size()); j++) c[i + j] = (c[i + j] + 1ULL * a[i] * b[j]) % MOD;
+  return c;
+}
+
+unsigned naiveEval(const Poly<> &a, unsigned x) {
+  unsigned v = 0;
+  for (int k = int(a.size()) - 1; k >= 0; k--) v = (1ULL * v * x + a[k]) % MOD;
+  return v;
+}
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 100;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 300 + 1;
+    Poly<> F(N);
+    for (auto &&f : F) f = rng() % MOD;
+    F[0] = 1;
+    Poly<> H = naiveMul(F, F.inv(N)).pre(N);
+    for (int i = 0; i < N; i++) assert(H[i] == (i == 0 ? 1U : 0U));
+    Poly<> L = F.log(N);
+    assert(L.exp(N) == F);
+    assert(F.inv(0).empty() && F.log(0).empty() && L.exp(0).empty());
+    Poly<> S = F.sqrt(N);
+    assert(naiveMul(S, S).pre(N) == F);
+    for (auto &&l : L) checkSum = 31 * checkSum + l;
+    for (auto &&s : S) checkSum = 31 * checkSum + s;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (Inverse, Log, Exp, Sqrt) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 100;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    Poly<> A(rng() % 300 + 1), B(rng() % 100 + 1);
+    for (auto &&a : A) a = rng() % MOD;
+    for (auto &&b : B) b = rng() % MOD;
+    B.back() = 1;
+    pair<Poly<>, Poly<>> QR = A.divmod(B);
+    assert(QR.second.size() < B.size());
+    Poly<> C = QR.first.empty() ? QR.second : naiveMul(QR.first, B) + QR.second;
+    assert(C.trim() == A.trim());
+    vector<unsigned> X(rng() % 200 + 1), Y;
+    for (auto &&x : X) x = rng() % MOD;
+    vector<unsigned> V = A.eval(X);
+    for (int i = 0; i < int(X.size()); i++) assert(V[i] == naiveEval(A, X[i]));
+    sort(X.begin(), X.end());
+    X.erase(unique(X.begin(), X.end()), X.end());
+    for (int i = 0; i < int(X.size()); i++) Y.push_back(rng() % MOD);
+    Poly<> P = Poly<>::interpolate(X, Y);
+    assert(P.size() <= X.size());
+    assert(P.eval(X) == Y);
+    for (auto &&v : V) checkSum = 31 * checkSum + v;
+    for (auto &&p : P) checkSum = 31 * checkSum + p;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Division, Multipoint Evaluation, Interpolation) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,109 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/math/Primes.h"
+using namespace std;
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 300, MAXN = 3e6;
+  long long checkSum = 0;
+  vector<bool> comp(MAXN + 1, false);
+  comp[0] = comp[1] = true;
+  for (int i = 2; i <= MAXN; i++) if (!comp[i]) for (long long j = 1LL * i * i; j <= MAXN; j += i) comp[j] = true;
+  WheelSieve sieve(MAXN);
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    long long lo = rng() % (MAXN + 1), hi = rng() % (MAXN + 1);
+    if (ti % 5 == 0) lo = rng() % 40;
+    if (lo > hi) swap(lo, hi);
+    vector<long long> P;
+    for (long long x = lo; x <= hi; x++) if (!comp[x]) P.push_back(x);
+    assert(sieve.primes(lo, hi) == P);
+    assert(sieve.count(lo, hi) == (long long)P.size());
+    for (auto &&p : P) checkSum = 31 * checkSum + p;
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (Wheel Sieve) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 20;
+  const long long MAXN = 1e12;
+  long long checkSum = 0;
+  WheelSieve sieve(MAXN);
+  ThreadPool::global().setThreads(4);
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    long long lo = rng() % MAXN, hi = min(MAXN, lo + (long long)(rng() % int(2e7)));
+    vector<long long> P = sieve.primes(lo, hi);
+    assert(sieve.primes<ParallelPolicy>(lo, hi) == P);
+    assert(sieve.count<ParallelPolicy>(lo, hi) == (long long)P.size());
+    for (auto &&p : P) checkSum = 31 * checkSum + p;
+  }
+  assert(sieve.count<ParallelPolicy>(0, 1e9) == 50847534);
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Parallel Wheel Sieve) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+vector<long long> trialDivision(long long x) {
+  vector<long long> ret;
+  for (long long i = 2; i * i <= x; i++) while (x % i == 0) { ret.push_back(i); x /= i; }
+  if (x > 1) ret.push_back(x);
+  return ret;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 100000;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    long long x = rng() % (ti % 100 == 0 ? (long long)1e12 : (long long)1e6) + 1;
+    vector<long long> P = trialDivision(x);
+    assert(primeFactor(x) == P);
+    assert(isPrime(x) == (P.size() == 1));
+    if (ti % 100 == 1) {
+      vector<long long> F;
+      for (long long d = 1; d * d <= x; d++) if (x % d == 0) { F.push_back(d); if (d * d != x) F.push_back(x / d); }
+      sort(F.begin(), F.end());
+      assert(factors(x) == F);
+    }
+    for (auto &&p : P) checkSum = 31 * checkSum + p;
+  }
+  assert(factors(0).empty());
+  assert(factors(-12).empty());
+  WheelSieve sieve(2e9);
+  vector<long long> P = sieve.primes(1e9, 1e9 + 1e6), X(2000);
+  for (auto &&x : X) x = P[rng() % P.size()] * P[rng() % P.size()];
+  for (int i = 0; i < 2000; i++) X.push_back((long long)(rng() % (unsigned long long)(1e18)) + 1);
+  ThreadPool::global().setThreads(4);
+  vector<vector<long long>> F = pollardsRhoPrimeFactorBatch<ParallelPolicy>(X);
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  assert(F == pollardsRhoPrimeFactorBatch(X));
+  for (int i = 0; i < int(X.size()); i++) {
+    long long prod = 1;
+    for (auto &&f : F[i]) { assert(millerRabin(f)); prod *= f; checkSum = 31 * checkSum + f; }
+    assert(prod == X[i]);
+  }
+  assert(millerRabin(18446744073709551557ULL) && !millerRabin(18446744073709551555ULL));
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (Factorization) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
@@ -0,0 +1,121 @@
+#include <bits/stdc++.h>
+#include "../../../Content/C++/string/FMIndex.h"
+using namespace std;
+
+void test1() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e4;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 200, K = ti % 3 == 0 ? 2 : ti % 3 == 1 ? 26 : int(1e9);
+    vector<long long> A(N);
+    for (auto &&a : A) a = (long long)(rng() % K) - K / 2;
+    WaveletMatrix<long long> W;
+    vector<long long> B = A;
+    for (auto &&b : B) b += K / 2;
+    W = WaveletMatrix<long long>(B.begin(), B.end());
+    for (int i = 0; i < N; i++) assert(W.get(i) == B[i]);
+    for (int q = 0; q < 20 && N > 0; q++) {
+      int l = rng() % N, r = rng() % N;
+      if (l > r) swap(l, r);
+      long long v = B[rng() % N] + int(rng() % 3) - 1, lo = v, hi = B[rng() % N];
+      vector<long long> sorted(B.begin() + l, B.begin() + r + 1);
+      sort(sorted.begin(), sorted.end());
+      int k = rng() % (r - l + 1);
+      assert(W.select(l, r, k) == sorted[k]);
+      int rk = lower_bound(sorted.begin(), sorted.end(), v) - sorted.begin();
+      assert(W.rank(l, r, v) == rk);
+      int cnt = 0;
+      for (auto &&s : sorted) cnt += lo <= s && s <= hi;
+      assert(W.count(l, r, lo, hi) == cnt);
+      assert(W.occ(v, r) == int(count(B.begin(), B.begin() + r, v)));
+      checkSum = 31 * checkSum + sorted[k];
+      checkSum = 31 * checkSum + rk;
+      checkSum = 31 * checkSum + cnt;
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 1 (Wavelet Matrix) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 1e4;
+  long long checkSum = 0;
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = rng() % 100, K = ti % 3 == 0 ? 2 : ti % 3 == 1 ? 4 : 26;
+    string S(N, 'a');
+    for (auto &&c : S) c = 'a' + rng() % K;
+    int rate = 1 + rng() % 8;
+    FMIndex<char> F(S.begin(), S.end(), rate);
+    SuffixArray<char> SA(S.begin(), S.end());
+    FMIndex<char> G(SA, rate);
+    assert(F.samples == G.samples && F.C == G.C);
+    for (int q = 0; q < 20; q++) {
+      string P;
+      if (N > 0 && q % 2 == 0) {
+        int i = rng() % N;
+        P = S.substr(i, rng() % (N - i + 1));
+      } else {
+        P.resize(rng() % 4);
+        for (auto &&c : P) c = 'a' + rng() % (K + 1);
+      }
+      vector<int> expected;
+      for (int i = 0; i + int(P.size()) <= N; i++)
+        if (S.compare(i, P.size(), P) == 0) expected.push_back(i);
+      vector<int> got = F.locate(P.begin(), P.end());
+      assert(int(got.size()) == F.count(P.begin(), P.end()));
+      assert(G.locate(P.begin(), P.end()) == got);
+      sort(got.begin(), got.end());
+      assert(got == expected);
+      checkSum = 31 * checkSum + got.size();
+      for (auto &&g : got) checkSum = 31 * checkSum + g;
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (FM-Index) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+void test3() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int N = 1e7, Q = 1e5;
+  long long checkSum = 0;
+  string S(N, 'A');
+  const string DNA = "ACGT";
+  for (auto &&c : S) c = DNA[rng() % 4];
+  FMIndex<char> F(S.begin(), S.end());
+  for (int q = 0; q < Q; q++) {
+    int len = 8 + rng() % 8, i = rng() % (N - len);
+    string P = S.substr(i, len);
+    int cnt = F.count(P.begin(), P.end());
+    assert(cnt >= 1);
+    checkSum = 31 * checkSum + cnt;
+    if (q % 100 == 0) {
+      vector<int> pos = F.locate(P.begin(), P.end());
+      assert(find(pos.begin(), pos.end(), i) != pos.end());
+      for (auto &&p : pos) checkSum = 31 * checkSum + p;
+    }
+  }
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 3 (Large DNA) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
+int main() {
+  test1();
+  test2();
+  test3();
+  cout << "Test Passed" << endl;
+  return 0;
+}
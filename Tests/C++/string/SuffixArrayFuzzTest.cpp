@@ -48,8 +48,36 @@ void test1() {
   cout << "  Checksum: " << checkSum << endl;
 }
 
+void test2() {
+  const auto start_time = chrono::system_clock::now();
+  mt19937_64 rng(0);
+  const int TESTCASES = 200;
+  long long checkSum = 0;
+  ThreadPool::global().setThreads(4);
+  for (int ti = 0; ti < TESTCASES; ti++) {
+    int N = ti % 20 == 0 ? 300000 : rng() % 3000, K = ti % 3 == 0 ? 2 : ti % 3 == 1 ? 26 : int(1e9);
+    vector<long long> A(N);
+    for (auto &&a : A) a = (long long)(rng() % K) - K / 2;
+    if (ti % 5 == 0) for (int i = N / 2; i < N; i++) A[i] = A[i - N / 2];
+    SuffixArray<long long, true> SA(A.begin(), A.end());
+    SuffixArray<long long> SB(A.begin(), A.end());
+    SuffixArray<long long, true, ParallelPolicy> SC(A.begin(), A.end());
+    assert(SA.ind == SB.ind && SA.rnk == SB.rnk && SA.LCP == SB.LCP);
+    assert(SA.ind == SC.ind && SA.rnk == SC.rnk && SA.LCP == SC.LCP);
+    for (auto &&a : SA.ind) checkSum = 31 * checkSum + a;
+    for (auto &&a : SA.LCP) checkSum = 31 * checkSum + a;
+  }
+  ThreadPool::global().setThreads(thread::hardware_concurrency());
+  const auto end_time = chrono::system_clock::now();
+  double sec = ((end_time - start_time).count() / double(chrono::system_clock::period::den));
+  cout << "Subtest 2 (Builders) Passed" << endl;
+  cout << "  Time: " << fixed << setprecision(3) << sec << "s" << endl;
+  cout << "  Checksum: " << checkSum << endl;
+}
+
 int main() {
   test1();
+  test2();
   cout << "Test Passed" << endl;
   return 0;
 }